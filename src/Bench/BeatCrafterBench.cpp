@@ -0,0 +1,370 @@
+#include "Core/FeatureIndex.h"
+#include "Core/PatternEngine.h"
+#include "Core/SeedExplorer.h"
+#include "Core/StyleManager.h"
+#include "Core/StepKernels.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::atomic<std::uint64_t> allocationCount{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+	using namespace BeatCrafter;
+	using Clock = std::chrono::steady_clock;
+
+	enum class OutputFormat
+	{
+		Json,
+		Csv
+	};
+
+	struct BenchOptions
+	{
+		OutputFormat format = OutputFormat::Json;
+		int intensityIterations = 2000;
+		double secondsPerBlockRun = 10.0;
+		std::uint32_t seed = 12345;
+	};
+
+	struct BenchResult
+	{
+		std::string benchmark;
+		std::string style;
+		double intensity = 0.0;
+		int bufferSize = 0;
+		double sampleRate = 0.0;
+		std::uint64_t calls = 0;
+		double nsPerCall = 0.0;
+		double allocationsPerCall = 0.0;
+	};
+
+	const char* styleName(StyleType style)
+	{
+		switch (style)
+		{
+		case StyleType::Rock: return "Rock";
+		case StyleType::Metal: return "Metal";
+		case StyleType::Jazz: return "Jazz";
+		case StyleType::Funk: return "Funk";
+		case StyleType::Electronic: return "Electronic";
+		case StyleType::HipHop: return "HipHop";
+		case StyleType::Latin: return "Latin";
+		case StyleType::Punk: return "Punk";
+		default: return "Unknown";
+		}
+	}
+
+	constexpr StyleType allStyles[] = {
+		StyleType::Rock, StyleType::Metal, StyleType::Jazz, StyleType::Funk,
+		StyleType::Electronic, StyleType::HipHop, StyleType::Latin, StyleType::Punk
+	};
+
+	// One representative value per threshold bucket in StyleManager::applyIntensity.
+	constexpr float intensityBuckets[] = { 0.0f, 0.1f, 0.3f, 0.5f, 0.7f, 0.95f };
+
+	constexpr int bufferSizes[] = { 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+	constexpr double sampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+
+	void benchApplyIntensity(const BenchOptions& options, std::vector<BenchResult>& results)
+	{
+		for (auto style : allStyles)
+		{
+			Pattern base("Bench");
+			StyleManager::generateBasicPattern(base, style, options.seed);
+
+			for (auto intensity : intensityBuckets)
+			{
+				for (int i = 0; i < 16; ++i)
+					StyleManager::applyIntensity(base, intensity, style, options.seed + (std::uint32_t)i);
+
+				auto allocationsBefore = allocationCount.load();
+				auto start = Clock::now();
+				for (int i = 0; i < options.intensityIterations; ++i)
+				{
+					auto result = StyleManager::applyIntensity(base, intensity, style, options.seed + (std::uint32_t)i);
+					(void)result;
+				}
+				auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+				auto allocations = allocationCount.load() - allocationsBefore;
+
+				BenchResult r;
+				r.benchmark = "applyIntensity";
+				r.style = styleName(style);
+				r.intensity = intensity;
+				r.calls = (std::uint64_t)options.intensityIterations;
+				r.nsPerCall = elapsed / options.intensityIterations;
+				r.allocationsPerCall = (double)allocations / options.intensityIterations;
+				results.push_back(r);
+			}
+		}
+	}
+
+	void benchProcessBlock(const BenchOptions& options, std::vector<BenchResult>& results)
+	{
+		constexpr double bpm = 120.0;
+
+		for (auto sampleRate : sampleRates)
+		{
+			for (auto bufferSize : bufferSizes)
+			{
+				auto engine = std::make_unique<PatternEngine>();
+				engine->setBackgroundRendering(false);
+				for (int slot = 0; slot < 8; ++slot)
+					engine->setSlotSeed(slot, options.seed + (std::uint32_t)slot);
+				engine->setIntensity(0.7f);
+				engine->start();
+
+				juce::MidiBuffer midi;
+				midi.ensureSize(4096);
+
+				juce::AudioPlayHead::PositionInfo posInfo;
+				posInfo.setIsPlaying(true);
+				posInfo.setBpm(bpm);
+
+				double ppqPerBlock = bufferSize * bpm / (60.0 * sampleRate);
+				auto numBlocks = (std::uint64_t)juce::jmax(1.0, options.secondsPerBlockRun * sampleRate / bufferSize);
+				double ppq = 0.0;
+
+				auto runBlock = [&]()
+					{
+						posInfo.setPpqPosition(ppq);
+						engine->processBlock(midi, bufferSize, sampleRate, posInfo);
+						ppq += ppqPerBlock;
+					};
+
+				for (int i = 0; i < 64; ++i)
+					runBlock();
+
+				auto allocationsBefore = allocationCount.load();
+				auto start = Clock::now();
+				for (std::uint64_t i = 0; i < numBlocks; ++i)
+					runBlock();
+				auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+				auto allocations = allocationCount.load() - allocationsBefore;
+
+				BenchResult r;
+				r.benchmark = "processBlock";
+				r.style = styleName(engine->getCurrentSlotStyle());
+				r.intensity = engine->getIntensity();
+				r.bufferSize = bufferSize;
+				r.sampleRate = sampleRate;
+				r.calls = numBlocks;
+				r.nsPerCall = elapsed / (double)numBlocks;
+				r.allocationsPerCall = (double)allocations / (double)numBlocks;
+				results.push_back(r);
+			}
+		}
+	}
+
+	struct KernelLanes
+	{
+		static constexpr int capacity = 128;
+
+		std::array<std::uint32_t, capacity> active;
+		std::array<std::uint32_t, capacity> hits;
+		std::array<float, capacity> velocity, probability, offsets, draws, chances;
+
+		void randomise(RandomState& rng)
+		{
+			for (int i = 0; i < capacity; ++i)
+			{
+				active[(size_t)i] = rng.nextChance(0.5f) ? (rng.nextUInt() | 1u) : 0u;
+				hits[(size_t)i] = rng.nextChance(0.3f) ? 1u : 0u;
+				velocity[(size_t)i] = rng.nextFloat(-0.5f, 1.5f);
+				probability[(size_t)i] = rng.nextChance(0.3f) ? 1.0f : rng.nextFloat(-0.5f, 1.5f);
+				offsets[(size_t)i] = rng.nextFloat(-0.5f, 0.5f);
+				draws[(size_t)i] = rng.nextFloat();
+				chances[(size_t)i] = rng.nextFloat(0.0f, 0.5f);
+			}
+		}
+	};
+
+	void benchStepKernels(const BenchOptions& options, std::vector<BenchResult>& results)
+	{
+		using ScaleKernel = void (*)(const std::uint32_t*, float*, float*, int, float, float);
+		const std::pair<const char*, ScaleKernel> kernels[] = {
+			{ "scalar", StepKernels::Scalar::scaleActive },
+			{ StepKernels::getInstructionSet(), StepKernels::scaleActive }
+		};
+
+		RandomState rng(options.seed);
+		KernelLanes lanes;
+		lanes.randomise(rng);
+		auto iterations = options.intensityIterations * 100;
+
+		for (const auto& kernel : kernels)
+		{
+			auto start = Clock::now();
+			for (int i = 0; i < iterations; ++i)
+				kernel.second(lanes.active.data(), lanes.velocity.data(), lanes.probability.data(),
+					KernelLanes::capacity, 1.0f, 1.0f);
+			auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			BenchResult r;
+			r.benchmark = "scaleActive";
+			r.style = kernel.first;
+			r.bufferSize = KernelLanes::capacity;
+			r.calls = (std::uint64_t)iterations;
+			r.nsPerCall = elapsed / iterations;
+			results.push_back(r);
+		}
+	}
+
+	// Nearest-neighbour queries against every variation of the built-in
+	// styles over 1024 seeds, one reference per style.
+	void benchFindNearest(const BenchOptions& options, std::vector<BenchResult>& results)
+	{
+		SeedExplorer::Grid grid;
+		for (auto style : allStyles)
+			grid.styles.push_back(StyleManager::getStyleDefinition(style));
+		for (std::uint32_t i = 0; i < 1024; ++i)
+			grid.seeds.push_back(options.seed + i);
+		grid.intensities = { 0.3f, 0.5f, 0.7f, 0.9f };
+
+		std::vector<SeedExplorer::Variation> variations(SeedExplorer::getNumVariations(grid));
+		SeedExplorer::explore(grid, variations.data());
+
+		FeatureIndex index;
+		index.reserve(variations.size());
+		for (const auto& v : variations)
+			index.add(v.features, v.style);
+
+		auto iterations = juce::jmax(1, options.intensityIterations / 10);
+		for (size_t s = 0; s < std::size(allStyles); ++s)
+		{
+			FeatureIndex::Query query(variations[s * grid.seeds.size() * grid.intensities.size()].features);
+
+			auto allocationsBefore = allocationCount.load();
+			auto start = Clock::now();
+			for (int i = 0; i < iterations; ++i)
+			{
+				auto matches = index.findNearest(query, 20);
+				(void)matches;
+			}
+			auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			auto allocations = allocationCount.load() - allocationsBefore;
+
+			BenchResult r;
+			r.benchmark = "findNearest";
+			r.style = styleName(allStyles[s]);
+			r.bufferSize = (int)index.size();
+			r.calls = (std::uint64_t)iterations;
+			r.nsPerCall = elapsed / iterations;
+			r.allocationsPerCall = (double)allocations / iterations;
+			results.push_back(r);
+		}
+	}
+
+	void printResults(const std::vector<BenchResult>& results, OutputFormat format)
+	{
+		if (format == OutputFormat::Csv)
+		{
+			std::printf("benchmark,style,intensity,buffer_size,sample_rate,calls,ns_per_call,allocs_per_call\n");
+			for (const auto& r : results)
+				std::printf("%s,%s,%.2f,%d,%.0f,%llu,%.1f,%.3f\n",
+					r.benchmark.c_str(), r.style.c_str(), r.intensity, r.bufferSize, r.sampleRate,
+					(unsigned long long)r.calls, r.nsPerCall, r.allocationsPerCall);
+			return;
+		}
+
+		std::printf("[\n");
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const auto& r = results[i];
+			std::printf("  {\"benchmark\": \"%s\", \"style\": \"%s\", \"intensity\": %.2f, \"buffer_size\": %d, "
+				"\"sample_rate\": %.0f, \"calls\": %llu, \"ns_per_call\": %.1f, \"allocs_per_call\": %.3f}%s\n",
+				r.benchmark.c_str(), r.style.c_str(), r.intensity, r.bufferSize, r.sampleRate,
+				(unsigned long long)r.calls, r.nsPerCall, r.allocationsPerCall,
+				i + 1 < results.size() ? "," : "");
+		}
+		std::printf("]\n");
+	}
+
+	bool parseOptions(int argc, char* argv[], BenchOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			auto value = [&](const char* name) -> const char*
+				{
+					auto prefix = std::string(name) + "=";
+					return arg.rfind(prefix, 0) == 0 ? argv[i] + prefix.size() : nullptr;
+				};
+
+			if (arg == "--csv")
+				options.format = OutputFormat::Csv;
+			else if (arg == "--json")
+				options.format = OutputFormat::Json;
+			else if (auto v = value("--iterations"))
+				options.intensityIterations = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--seconds"))
+				options.secondsPerBlockRun = juce::jmax(0.1, std::atof(v));
+			else if (auto v = value("--seed"))
+				options.seed = (std::uint32_t)std::strtoul(v, nullptr, 10);
+			else
+			{
+				std::fprintf(stderr, "usage: beatcrafter_bench [--json|--csv] [--iterations=N] [--seconds=S] [--seed=N]\n");
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchOptions options;
+	if (!parseOptions(argc, argv, options))
+		return 1;
+
+	std::vector<BenchResult> results;
+	results.reserve(std::size(allStyles) * (std::size(intensityBuckets) + 1) + std::size(sampleRates) * std::size(bufferSizes) + 2);
+
+	benchStepKernels(options, results);
+	benchApplyIntensity(options, results);
+	benchFindNearest(options, results);
+	benchProcessBlock(options, results);
+	printResults(results, options.format);
+	return 0;
+}
@@ -0,0 +1,131 @@
+#include "FeatureIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace BeatCrafter
+{
+	namespace
+	{
+		bool isCloser(const FeatureIndex::Match& a, const FeatureIndex::Match& b)
+		{
+			return a.distance < b.distance || (a.distance == b.distance && a.index < b.index);
+		}
+	}
+
+	FeatureIndex::Query::Query(const PatternFeatures& referenceFeatures)
+		: reference(referenceFeatures)
+	{
+		trackWeights.fill(1.0f);
+		minTrackDensity.fill(0.0f);
+		maxTrackDensity.fill(1.0f);
+	}
+
+	void FeatureIndex::reserve(size_t capacity)
+	{
+		onsets.reserve(capacity * maxTracks * maskWords);
+		trackDensity.reserve(capacity * maxTracks);
+		density.reserve(capacity);
+		syncopation.reserve(capacity);
+		meanVelocity.reserve(capacity);
+		lengths.reserve(capacity);
+		tags.reserve(capacity);
+	}
+
+	void FeatureIndex::clear()
+	{
+		onsets.clear();
+		trackDensity.clear();
+		density.clear();
+		syncopation.clear();
+		meanVelocity.clear();
+		lengths.clear();
+		tags.clear();
+	}
+
+	size_t FeatureIndex::add(const PatternFeatures& features, int tag)
+	{
+		for (const auto& track : features.onsets)
+			onsets.insert(onsets.end(), track.begin(), track.end());
+		trackDensity.insert(trackDensity.end(), features.trackDensity.begin(), features.trackDensity.end());
+		density.push_back(features.density);
+		syncopation.push_back(features.syncopation);
+		meanVelocity.push_back(features.meanVelocity);
+		lengths.push_back(features.length);
+		tags.push_back(tag);
+		return tags.size() - 1;
+	}
+
+	std::vector<FeatureIndex::Match> FeatureIndex::findNearest(const Query& query, int maxResults) const
+	{
+		std::vector<Match> best;
+		if (maxResults <= 0)
+			return best;
+		best.reserve((size_t)maxResults + 1);
+
+		const auto& reference = query.reference;
+		int activeTracks[maxTracks];
+		int boundedTracks[maxTracks];
+		int numActiveTracks = 0;
+		int numBoundedTracks = 0;
+		for (int t = 0; t < maxTracks; ++t)
+		{
+			if (query.trackWeights[(size_t)t] != 0.0f)
+				activeTracks[numActiveTracks++] = t;
+			if (query.minTrackDensity[(size_t)t] > 0.0f || query.maxTrackDensity[(size_t)t] < 1.0f)
+				boundedTracks[numBoundedTracks++] = t;
+		}
+
+		// best is a max-heap on distance once full, so best.front() is the
+		// candidate to beat; the scalar terms are summed first so most
+		// candidates are rejected before any mask is touched.
+		for (size_t i = 0; i < tags.size(); ++i)
+		{
+			if (query.tag >= 0 && tags[i] != query.tag)
+				continue;
+
+			const float* densities = trackDensity.data() + i * maxTracks;
+			bool inRange = true;
+			for (int n = 0; n < numBoundedTracks && inRange; ++n)
+			{
+				auto t = (size_t)boundedTracks[n];
+				inRange = densities[t] >= query.minTrackDensity[t] && densities[t] <= query.maxTrackDensity[t];
+			}
+			if (!inRange)
+				continue;
+
+			float distance = query.densityWeight * std::abs(density[i] - reference.density)
+				+ query.syncopationWeight * std::abs(syncopation[i] - reference.syncopation)
+				+ query.velocityWeight * std::abs(meanVelocity[i] - reference.meanVelocity);
+
+			bool full = best.size() == (size_t)maxResults;
+			if (full && distance > best.front().distance)
+				continue;
+
+			const uint64_t* masks = onsets.data() + i * maxTracks * maskWords;
+			float lengthScale = 1.0f / (float)juce::jmax(1, juce::jmax(lengths[i], reference.length));
+			for (int n = 0; n < numActiveTracks; ++n)
+			{
+				int t = activeTracks[n];
+				int mismatches = 0;
+				for (int word = 0; word < maskWords; ++word)
+					mismatches += juce::countNumberOfBits((juce::uint64)(masks[t * maskWords + word] ^ reference.onsets[(size_t)t][(size_t)word]));
+				distance += query.trackWeights[(size_t)t] * (float)mismatches * lengthScale;
+			}
+
+			Match match{ i, distance };
+			if (full)
+			{
+				if (!isCloser(match, best.front()))
+					continue;
+				std::pop_heap(best.begin(), best.end(), isCloser);
+				best.back() = match;
+			}
+			else
+				best.push_back(match);
+			std::push_heap(best.begin(), best.end(), isCloser);
+		}
+
+		std::sort_heap(best.begin(), best.end(), isCloser);
+		return best;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "PatternFeatures.h"
+#include <array>
+#include <vector>
+
+namespace BeatCrafter
+{
+	// In-memory nearest-neighbour index over PatternFeatures. Entries are
+	// stored column by column (onset masks, per-track densities, scalars)
+	// and searched with a linear popcount scan, which keeps queries over
+	// tens of thousands of candidates in the millisecond range without
+	// any tree to rebuild on insert.
+	class FeatureIndex
+	{
+	public:
+		static constexpr int maxTracks = PatternFeatures::maxTracks;
+		static constexpr int maskWords = PatternFeatures::maskWords;
+
+		// Distance to the reference is the weighted sum of the per-track
+		// onset mismatch (Hamming distance over the longer length) and the
+		// differences in density, syncopation and mean velocity. Candidates
+		// whose track densities fall outside [minTrackDensity, maxTrackDensity]
+		// or whose tag differs (unless tag < 0) are skipped. Weights must not
+		// be negative.
+		struct Query
+		{
+			explicit Query(const PatternFeatures& referenceFeatures);
+
+			PatternFeatures reference;
+			std::array<float, maxTracks> trackWeights;
+			std::array<float, maxTracks> minTrackDensity;
+			std::array<float, maxTracks> maxTrackDensity;
+			float densityWeight = 1.0f;
+			float syncopationWeight = 1.0f;
+			float velocityWeight = 1.0f;
+			int tag = -1;
+		};
+
+		struct Match
+		{
+			size_t index = 0;
+			float distance = 0.0f;
+		};
+
+		void reserve(size_t capacity);
+		void clear();
+
+		// Returns the entry's index; tag is free for the caller, e.g. a style or slot.
+		size_t add(const PatternFeatures& features, int tag = 0);
+
+		size_t size() const { return tags.size(); }
+		int getTag(size_t index) const { return tags[index]; }
+		float getDensity(size_t index) const { return density[index]; }
+		float getSyncopation(size_t index) const { return syncopation[index]; }
+		float getMeanVelocity(size_t index) const { return meanVelocity[index]; }
+		float getTrackDensity(size_t index, int track) const { return trackDensity[index * maxTracks + (size_t)track]; }
+
+		// Up to maxResults matches ordered by ascending distance, ties by index.
+		std::vector<Match> findNearest(const Query& query, int maxResults) const;
+
+	private:
+		std::vector<uint64_t> onsets;
+		std::vector<float> trackDensity;
+		std::vector<float> density;
+		std::vector<float> syncopation;
+		std::vector<float> meanVelocity;
+		std::vector<int> lengths;
+		std::vector<int> tags;
+	};
+}
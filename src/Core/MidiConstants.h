@@ -24,6 +24,35 @@ namespace BeatCrafter {
 		constexpr int TAMBOURINE = 54;
 		constexpr int CHINA_CYMBAL = 52;
 		constexpr int SPLASH_CYMBAL = 55;
+
+		constexpr int CHANNEL = 10;
+
+		constexpr double getGateLengthMs(int note)
+		{
+			switch (note)
+			{
+			case HIHAT_CLOSED:
+			case HIHAT_PEDAL:
+				return 45.0;
+			case HIHAT_OPEN:
+				return 220.0;
+			case CRASH_1:
+			case CRASH_2:
+			case CHINA_CYMBAL:
+			case SPLASH_CYMBAL:
+			case RIDE:
+			case RIDE_BELL:
+				return 300.0;
+			case TOM_HIGH:
+			case TOM_MID:
+			case TOM_LOW:
+			case TOM_FLOOR_HI:
+			case TOM_FLOOR_LO:
+				return 150.0;
+			default:
+				return 100.0;
+			}
+		}
 	}
 
 	enum class StyleType {
@@ -38,11 +67,17 @@ namespace BeatCrafter {
 	};
 
 	struct TimeSignature {
-		int numerator;
-		int denominator;
+		int numerator = 4;
+		int denominator = 4;
+		int stepsPerQuarter = 4;
 
 		int getStepsPerBar() const {
-			return (numerator * 4) / denominator * 4;
+			int steps = numerator * stepsPerQuarter * 4 / denominator;
+			return steps > 0 ? steps : 1;
+		}
+
+		double getPpqPerStep() const {
+			return 1.0 / stepsPerQuarter;
 		}
 	};
 
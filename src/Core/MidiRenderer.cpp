@@ -0,0 +1,128 @@
+#include "MidiRenderer.h"
+#include <algorithm>
+
+namespace BeatCrafter
+{
+	double MidiRenderer::getPpqPerBar(const Settings& settings)
+	{
+		if (settings.meter.numerator <= 0 || settings.meter.denominator <= 0)
+			return 4.0;
+		return settings.meter.numerator * 4.0 / settings.meter.denominator;
+	}
+
+	float MidiRenderer::getIntensityAt(const std::vector<IntensityPoint>& curve, double bar)
+	{
+		if (curve.empty())
+			return 0.5f;
+		if (bar <= curve.front().bar)
+			return curve.front().intensity;
+		if (bar >= curve.back().bar)
+			return curve.back().intensity;
+
+		auto next = std::upper_bound(curve.begin(), curve.end(), bar,
+			[](double b, const IntensityPoint& point) { return b < point.bar; });
+		auto prev = next - 1;
+		double span = next->bar - prev->bar;
+		float t = span > 0.0 ? (float)((bar - prev->bar) / span) : 1.0f;
+		return juce::jlimit(0.0f, 1.0f, prev->intensity + (next->intensity - prev->intensity) * t);
+	}
+
+	juce::MidiMessageSequence MidiRenderer::render(PatternEngine& engine, const Settings& settings)
+	{
+		juce::MidiMessageSequence sequence;
+		if (settings.bars <= 0 || settings.bpm <= 0.0 || settings.sampleRate <= 0.0 || settings.blockSize <= 0)
+			return sequence;
+
+		auto curve = settings.intensityCurve;
+		std::stable_sort(curve.begin(), curve.end(),
+			[](const IntensityPoint& a, const IntensityPoint& b) { return a.bar < b.bar; });
+		auto cues = settings.slotCues;
+		std::stable_sort(cues.begin(), cues.end(),
+			[](const SlotCue& a, const SlotCue& b) { return a.bar < b.bar; });
+
+		engine.setBackgroundRendering(false);
+		engine.stop();
+		engine.setTripletMode(settings.tripletMode);
+		engine.setHumanizeEnabled(settings.humanize);
+		engine.setPlaybackSeed(settings.playbackSeed);
+		engine.switchToSlot(settings.startSlot, true, getIntensityAt(curve, 0.0));
+		engine.start();
+
+		juce::MidiBuffer midi;
+		midi.ensureSize(4096);
+
+		juce::AudioPlayHead::PositionInfo posInfo;
+		posInfo.setIsPlaying(true);
+		posInfo.setBpm(settings.bpm);
+
+		double ppqPerBar = getPpqPerBar(settings);
+		double samplesPerPpq = settings.sampleRate * 60.0 / settings.bpm;
+		double ticksPerSample = settings.ticksPerQuarterNote / samplesPerPpq;
+		auto totalSamples = (juce::int64)std::ceil(settings.bars * ppqPerBar * samplesPerPpq);
+		size_t nextCue = 0;
+
+		auto appendBlock = [&](juce::int64 blockStart)
+			{
+				for (const auto metadata : midi)
+					sequence.addEvent(metadata.getMessage(),
+						(double)(blockStart + metadata.samplePosition) * ticksPerSample);
+			};
+
+		juce::int64 blockStart = 0;
+		while (blockStart < totalSamples)
+		{
+			int numSamples = (int)juce::jmin<juce::int64>(settings.blockSize, totalSamples - blockStart);
+			double ppq = (double)blockStart / samplesPerPpq;
+			double windowEndPpq = (double)(blockStart + numSamples) / samplesPerPpq + engine.getLookAheadPpq();
+
+			engine.setIntensity(getIntensityAt(curve, ppq / ppqPerBar));
+			while (nextCue < cues.size() && cues[nextCue].bar * ppqPerBar < windowEndPpq)
+				engine.switchToSlot(cues[nextCue++].slot, true);
+
+			posInfo.setPpqPosition(ppq);
+			engine.processBlock(midi, numSamples, settings.sampleRate, posInfo);
+			appendBlock(blockStart);
+			blockStart += numSamples;
+		}
+
+		engine.stop();
+		posInfo.setIsPlaying(false);
+		posInfo.setPpqPosition((double)blockStart / samplesPerPpq);
+		engine.processBlock(midi, 1, settings.sampleRate, posInfo);
+		appendBlock(blockStart);
+
+		sequence.sort();
+		sequence.updateMatchedPairs();
+		return sequence;
+	}
+
+	juce::MidiFile MidiRenderer::createMidiFile(const juce::MidiMessageSequence& sequence, const Settings& settings)
+	{
+		juce::MidiMessageSequence track;
+		track.addEvent(juce::MidiMessage::tempoMetaEvent(juce::roundToInt(60000000.0 / settings.bpm)), 0.0);
+		track.addEvent(juce::MidiMessage::timeSignatureMetaEvent(settings.meter.numerator, settings.meter.denominator), 0.0);
+		track.addSequence(sequence, 0.0);
+
+		double endTick = settings.bars * getPpqPerBar(settings) * settings.ticksPerQuarterNote;
+		track.addEvent(juce::MidiMessage::endOfTrack(), juce::jmax(endTick, track.getEndTime()));
+		track.updateMatchedPairs();
+
+		juce::MidiFile file;
+		file.setTicksPerQuarterNote(settings.ticksPerQuarterNote);
+		file.addTrack(track);
+		return file;
+	}
+
+	bool MidiRenderer::writeMidiFile(const juce::MidiMessageSequence& sequence, const Settings& settings,
+		const juce::File& file)
+	{
+		auto midiFile = createMidiFile(sequence, settings);
+
+		file.deleteFile();
+		juce::FileOutputStream stream(file);
+		if (!stream.openedOk())
+			return false;
+
+		return midiFile.writeTo(stream);
+	}
+}
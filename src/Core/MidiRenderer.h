@@ -0,0 +1,50 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "PatternEngine.h"
+#include <vector>
+
+namespace BeatCrafter
+{
+	// Renders an engine offline by driving PatternEngine::processBlock with a
+	// synthetic transport, so the result matches what the plugin plays live.
+	class MidiRenderer
+	{
+	public:
+		struct IntensityPoint
+		{
+			double bar = 0.0;
+			float intensity = 0.5f;
+		};
+
+		struct SlotCue
+		{
+			int bar = 0;
+			int slot = 0;
+		};
+
+		struct Settings
+		{
+			int bars = 8;
+			double bpm = 120.0;
+			double sampleRate = 48000.0;
+			int blockSize = 512;
+			int ticksPerQuarterNote = 960;
+			TimeSignature meter;
+			int startSlot = 0;
+			bool tripletMode = false;
+			bool humanize = true;
+			uint64_t playbackSeed = 0;
+			std::vector<IntensityPoint> intensityCurve;
+			std::vector<SlotCue> slotCues;
+		};
+
+		static juce::MidiMessageSequence render(PatternEngine& engine, const Settings& settings);
+		static juce::MidiFile createMidiFile(const juce::MidiMessageSequence& sequence, const Settings& settings);
+		static bool writeMidiFile(const juce::MidiMessageSequence& sequence, const Settings& settings,
+			const juce::File& file);
+
+		static float getIntensityAt(const std::vector<IntensityPoint>& curve, double bar);
+		static double getPpqPerBar(const Settings& settings);
+	};
+}
@@ -0,0 +1,95 @@
+#include "NoteScheduler.h"
+
+namespace BeatCrafter
+{
+	bool NoteScheduler::schedule(int channel, int midiNote, juce::uint8 velocity,
+		juce::int64 noteOnSample, juce::int64 noteOffSample)
+	{
+		noteOffSample = juce::jmax(noteOnSample + 1, noteOffSample);
+
+		for (int i = 0; i < numPending; ++i)
+		{
+			auto& other = pending[i];
+			if (other.channel != channel || other.midiNote != midiNote)
+				continue;
+
+			if (other.noteOnSample < noteOnSample)
+				other.noteOffSample = juce::jlimit(other.noteOnSample + 1, other.noteOffSample, noteOnSample);
+			else
+				noteOffSample = juce::jlimit(noteOnSample + 1, noteOffSample, other.noteOnSample);
+		}
+
+		if (numPending >= capacity)
+			return false;
+
+		auto& note = pending[numPending++];
+		note.noteOnSample = noteOnSample;
+		note.noteOffSample = noteOffSample;
+		note.channel = channel;
+		note.midiNote = midiNote;
+		note.velocity = velocity;
+		note.noteOnSent = false;
+		note.noteOffSent = false;
+		return true;
+	}
+
+	void NoteScheduler::renderBlock(juce::MidiBuffer& midiMessages, juce::int64 blockStartSample, int numSamples)
+	{
+		juce::int64 blockEndSample = blockStartSample + numSamples;
+		auto offsetOf = [blockStartSample](juce::int64 sample)
+			{
+				return static_cast<int>(juce::jmax<juce::int64>(0, sample - blockStartSample));
+			};
+
+		for (int i = 0; i < numPending; ++i)
+		{
+			auto& note = pending[i];
+			bool sounding = note.noteOnSent || note.noteOnSample < blockEndSample;
+			if (sounding && note.noteOffSample < blockEndSample)
+			{
+				midiMessages.addEvent(juce::MidiMessage::noteOff(note.channel, note.midiNote),
+					offsetOf(note.noteOffSample));
+				note.noteOffSent = true;
+			}
+		}
+
+		for (int i = numPending - 1; i >= 0; --i)
+		{
+			auto& note = pending[i];
+			if (!note.noteOnSent && note.noteOnSample < blockEndSample)
+			{
+				midiMessages.addEvent(juce::MidiMessage::noteOn(note.channel, note.midiNote, note.velocity),
+					offsetOf(note.noteOnSample));
+				note.noteOnSent = true;
+			}
+
+			if (note.noteOffSent)
+				removeAt(i);
+		}
+	}
+
+	void NoteScheduler::releaseAll(juce::int64 atSample)
+	{
+		for (int i = numPending - 1; i >= 0; --i)
+		{
+			auto& note = pending[i];
+			if (note.noteOnSample >= atSample)
+				removeAt(i);
+			else
+				note.noteOffSample = juce::jlimit(note.noteOnSample + 1, note.noteOffSample, atSample);
+		}
+	}
+
+	void NoteScheduler::flush(juce::MidiBuffer& midiMessages, int sampleOffset)
+	{
+		for (int i = 0; i < numPending; ++i)
+			if (pending[i].noteOnSent)
+				midiMessages.addEvent(juce::MidiMessage::noteOff(pending[i].channel, pending[i].midiNote), sampleOffset);
+		numPending = 0;
+	}
+
+	void NoteScheduler::removeAt(int index)
+	{
+		pending[index] = pending[--numPending];
+	}
+}
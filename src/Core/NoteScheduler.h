@@ -0,0 +1,38 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+
+namespace BeatCrafter
+{
+	class NoteScheduler
+	{
+	public:
+		static constexpr int capacity = 256;
+
+		bool schedule(int channel, int midiNote, juce::uint8 velocity,
+			juce::int64 noteOnSample, juce::int64 noteOffSample);
+		void renderBlock(juce::MidiBuffer& midiMessages, juce::int64 blockStartSample, int numSamples);
+		void releaseAll(juce::int64 atSample);
+		void flush(juce::MidiBuffer& midiMessages, int sampleOffset);
+
+		int getNumPending() const { return numPending; }
+
+	private:
+		struct ScheduledNote
+		{
+			juce::int64 noteOnSample = 0;
+			juce::int64 noteOffSample = 0;
+			int channel = 10;
+			int midiNote = 0;
+			juce::uint8 velocity = 0;
+			bool noteOnSent = false;
+			bool noteOffSent = false;
+		};
+
+		std::array<ScheduledNote, capacity> pending;
+		int numPending = 0;
+
+		void removeAt(int index);
+	};
+}
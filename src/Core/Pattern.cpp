@@ -41,31 +41,52 @@ namespace BeatCrafter {
 		probability = juce::jlimit(0.0f, 1.0f, p);
 	}
 
+	Track::StepRef& Track::StepRef::operator=(const Step& step) {
+		setActive(step.isActive());
+		setVelocity(step.getVelocity());
+		setMicroTiming(step.getMicroTiming());
+		setProbability(step.getProbability());
+		return *this;
+	}
+
+	Track::StepRef::operator Step() const {
+		Step step;
+		step.setActive(isActive());
+		step.setVelocity(getVelocity());
+		step.setMicroTiming(getMicroTiming());
+		step.setProbability(getProbability());
+		return step;
+	}
+
 	Track::Track(const juce::String& name, int midiNote)
 		: trackName(name),
 		midiNoteNumber(midiNote) {
-		steps.resize(16);
+		setLength(16);
 	}
 
-	Step& Track::getStep(int index) {
-		jassert(index >= 0 && index < steps.size());
-		return steps[index];
+	Track::StepRef Track::getStep(int index) {
+		jassert(index >= 0 && index < getLength());
+		return StepRef(*this, index);
 	}
 
-	const Step* Track::getStep(int index) const
+	std::optional<Step> Track::getStep(int index) const
 	{
-		if (index < 0 || index >= steps.size())
-			return nullptr;
+		if (index < 0 || index >= getLength())
+			return std::nullopt;
 
-		return &steps[index];
+		return static_cast<Step>(StepRef(const_cast<Track&>(*this), index));
 	}
 
 	void Track::setLength(int numSteps) {
-		steps.resize(numSteps);
+		Step defaults;
+		active.resize((size_t)numSteps, defaults.isActive() ? 1u : 0u);
+		velocities.resize((size_t)numSteps, defaults.getVelocity());
+		microTimings.resize((size_t)numSteps, defaults.getMicroTiming());
+		probabilities.resize((size_t)numSteps, defaults.getProbability());
 	}
 
 	int Track::getLength() const {
-		return static_cast<int>(steps.size());
+		return static_cast<int>(active.size());
 	}
 
 	juce::String Track::getName() const {
@@ -85,12 +106,10 @@ namespace BeatCrafter {
 	}
 
 	void Track::clear() {
-		for (auto& step : steps) {
-			step.setActive(false);
-			step.setVelocity(0.8f);
-			step.setMicroTiming(0.0f);
-			step.setProbability(1.0f);
-		}
+		std::fill(active.begin(), active.end(), 0u);
+		std::fill(velocities.begin(), velocities.end(), 0.8f);
+		std::fill(microTimings.begin(), microTimings.end(), 0.0f);
+		std::fill(probabilities.begin(), probabilities.end(), 1.0f);
 	}
 
 	Pattern::Pattern(const juce::String& name)
@@ -175,6 +194,15 @@ namespace BeatCrafter {
 		setLength(ts.getStepsPerBar());
 	}
 
+	int Pattern::getNumBars() const {
+		int stepsPerBar = signature.getStepsPerBar();
+		return juce::jmax(1, (getLength() + stepsPerBar - 1) / stepsPerBar);
+	}
+
+	void Pattern::setNumBars(int numBars) {
+		setLength(juce::jmax(1, numBars) * signature.getStepsPerBar());
+	}
+
 	void Pattern::clear() {
 		for (auto& track : tracks) {
 			track.clear();
@@ -3,6 +3,7 @@
 #include "MidiConstants.h"
 #include "StyleManager.h" 
 #include <array>
+#include <optional>
 #include <vector>
 
 namespace BeatCrafter {
@@ -30,14 +31,47 @@ namespace BeatCrafter {
 		float probability;
 	};
 
+	// Steps are stored as contiguous per-field lanes so StepKernels can run on
+	// a track in place; getStep hands out a Step-shaped view of one index.
 	class Track {
 	public:
+		class StepRef {
+		public:
+			StepRef& operator=(const StepRef& other) { return *this = static_cast<Step>(other); }
+			StepRef& operator=(const Step& step);
+			operator Step() const;
+
+			bool isActive() const { return track.active[(size_t)index] != 0; }
+			void setActive(bool shouldBeActive) { track.active[(size_t)index] = shouldBeActive ? 1u : 0u; }
+
+			float getVelocity() const { return track.velocities[(size_t)index]; }
+			void setVelocity(float v) { track.velocities[(size_t)index] = juce::jlimit(0.0f, 1.0f, v); }
+
+			float getMicroTiming() const { return track.microTimings[(size_t)index]; }
+			void setMicroTiming(float mt) { track.microTimings[(size_t)index] = juce::jlimit(-0.5f, 0.5f, mt); }
+
+			float getProbability() const { return track.probabilities[(size_t)index]; }
+			void setProbability(float p) { track.probabilities[(size_t)index] = juce::jlimit(0.0f, 1.0f, p); }
+
+		private:
+			friend class Track;
+			StepRef(Track& t, int i) : track(t), index(i) {}
+
+			Track& track;
+			int index;
+		};
+
 		Track(const juce::String& name, int midiNote);
-		Step& getStep(int index);
+		StepRef getStep(int index);
 
-		const Step* getStep(int index) const;
+		std::optional<Step> getStep(int index) const;
 		void setLength(int numSteps);
 
+		// StepKernels lanes, getLength() entries each; active is 0 or non-zero.
+		uint32_t* getActiveLane() { return active.data(); }
+		float* getVelocityLane() { return velocities.data(); }
+		float* getProbabilityLane() { return probabilities.data(); }
+
 		int getLength() const;
 
 		juce::String getName() const;
@@ -51,7 +85,10 @@ namespace BeatCrafter {
 	private:
 		juce::String trackName;
 		int midiNoteNumber;
-		std::vector<Step> steps;
+		std::vector<uint32_t> active;
+		std::vector<float> velocities;
+		std::vector<float> microTimings;
+		std::vector<float> probabilities;
 	};
 
 	class Pattern {
@@ -80,6 +117,9 @@ namespace BeatCrafter {
 
 		TimeSignature getTimeSignature() const;
 		void setTimeSignature(TimeSignature ts);
+
+		int getNumBars() const;
+		void setNumBars(int numBars);
 		void clear();
 
 	private:
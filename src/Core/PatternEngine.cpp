@@ -1,4 +1,6 @@
 ﻿#include "PatternEngine.h"
+#include "StepKernels.h"
+#include <limits>
 #include <random>
 
 namespace BeatCrafter
@@ -21,25 +23,276 @@ namespace BeatCrafter
 		for (int i = 0; i < 8; ++i)
 		{
 			slotStyles[i] = defaultStyles[i];
+			slotStyleDefinitions[i] = std::make_shared<const StyleTable::StyleDefinition>(StyleManager::getStyleDefinition(defaultStyles[i]));
 			slotRandomSeeds[i] = rd();
+			slotBars[i] = 1;
+		}
+
+		playbackRandom.setSeed(rd());
+		renderThread.startThread();
+	}
+
+	PatternEngine::~PatternEngine()
+	{
+		renderThread.stopThread(1000);
+	}
 
-			auto pattern = std::make_unique<Pattern>("Slot " + juce::String(i + 1));
-			StyleManager::generateBasicPattern(*pattern, defaultStyles[i]);
-			StyleManager::applyComplexityToPattern(*pattern, defaultStyles[i],
-				0.5f, slotRandomSeeds[i]);
-			slots[i] = std::move(pattern);
+	void PatternEngine::setBackgroundRendering(bool shouldRenderInBackground)
+	{
+		if (shouldRenderInBackground)
+			renderThread.startThread();
+		else
+			renderThread.stopThread(1000);
+	}
+
+	void PatternEngine::invalidateCache()
+	{
+		displayDirty.store(true);
+	}
+
+	void PatternEngine::markSlotDirty(int slot)
+	{
+		if (slot >= 0 && slot < 8)
+		{
+			dirtySlotMask.fetch_or(1u << slot);
+			stateDirtySlotMask.fetch_or(1u << slot);
 		}
 	}
 
-	void PatternEngine::resetToStart()
+	void PatternEngine::RenderThread::run()
+	{
+		wait(prewarmDelayMs);
+
+		int idleWaitMs = 1;
+		while (!threadShouldExit())
+		{
+			if (engine.renderDirtySlots())
+				idleWaitMs = 1;
+			else
+				idleWaitMs = juce::jmin(idleWaitMs * 2, maxRenderIdleWaitMs);
+
+			wait(idleWaitMs);
+		}
+	}
+
+	int PatternEngine::getSlotByPriority(int centre, int order)
 	{
-		for (auto& slot : slots)
+		int distance = (order + 1) / 2;
+		int offset = (order % 2 == 1) ? distance : -distance;
+		return ((centre + offset) % 8 + 8) % 8;
+	}
+
+	bool PatternEngine::renderRequestedSlots()
+	{
+		bool didWork = false;
+		uint32_t requested = requestedSlotMask.exchange(0);
+		for (int slot = 0; slot < 8; ++slot)
 		{
-			if (slot)
+			uint32_t bit = 1u << slot;
+			if ((requested & bit) == 0)
+				continue;
+
+			generateSlot(slot);
+			if ((dirtySlotMask.fetch_and(~bit) & bit) != 0)
+				renderSlot(slot);
+			didWork = true;
+		}
+
+		return didWork;
+	}
+
+	bool PatternEngine::renderDirtySlots()
+	{
+		bool didWork = renderRequestedSlots();
+
+		int centre = displaySlot.load();
+		for (int order = 0; order < 8; ++order)
+		{
+			int slot = getSlotByPriority(centre, order);
+			uint32_t bit = 1u << slot;
+			if ((pendingSlotMask.load() & bit) != 0)
+			{
+				generateSlot(slot);
+				didWork = true;
+			}
+
+			if ((dirtySlotMask.fetch_and(~bit) & bit) != 0)
 			{
-				slot->setCurrentStep(0);
+				renderSlot(slot);
+				didWork = true;
 			}
 		}
+
+		return didWork;
+	}
+
+	void PatternEngine::generateSlot(int slot)
+	{
+		uint32_t bit = 1u << slot;
+		StyleDefinitionPtr style;
+		uint32_t seed;
+		TimeSignature signature;
+		int numBars;
+		{
+			const juce::ScopedLock sl(slotLock);
+			if ((pendingSlotMask.load() & bit) == 0)
+				return;
+
+			style = slotStyleDefinitions[slot];
+			seed = slotRandomSeeds[slot];
+			signature = slotGrids[slot];
+			numBars = slotBars[slot];
+		}
+
+		auto pattern = std::make_unique<Pattern>("Slot " + juce::String(slot + 1));
+		pattern->setTimeSignature(signature);
+		pattern->setNumBars(numBars);
+		StyleManager::generateBasicPattern(*pattern, *style, seed);
+		StyleManager::applyComplexityToPattern(*pattern, *style, 0.5f, seed);
+
+		{
+			const juce::ScopedLock sl(slotLock);
+			if ((pendingSlotMask.load() & bit) == 0)
+				return;
+
+			slots[slot] = std::move(pattern);
+			pendingSlotMask.fetch_and(~bit);
+		}
+		markSlotDirty(slot);
+	}
+
+	std::optional<Pattern> PatternEngine::copySlot(int slot) const
+	{
+		if (slot < 0 || slot >= 8)
+			return std::nullopt;
+
+		const juce::ScopedLock sl(slotLock);
+		if (!slots[slot])
+			return std::nullopt;
+		return *slots[slot];
+	}
+
+	void PatternEngine::ensureSlot(int slot)
+	{
+		if (slot >= 0 && slot < 8)
+			generateSlot(slot);
+	}
+
+	void PatternEngine::requestSlot(int slot)
+	{
+		if (slot < 0 || slot >= 8)
+			return;
+
+		uint32_t bit = 1u << slot;
+		if ((pendingSlotMask.load() & bit) == 0)
+			return;
+
+		requestedSlotMask.fetch_or(bit);
+		renderThread.notify();
+	}
+
+	void PatternEngine::setSlotStyle(int slot, StyleType style)
+	{
+		setSlotStyle(slot, std::make_shared<const StyleTable::StyleDefinition>(StyleManager::getStyleDefinition(style)), {});
+	}
+
+	void PatternEngine::setSlotStyle(int slot, StyleDefinitionPtr definition, const juce::String& name)
+	{
+		if (slot < 0 || slot >= 8 || !definition)
+			return;
+
+		{
+			const juce::ScopedLock sl(slotLock);
+			slotStyles[slot] = definition->family;
+			slotStyleDefinitions[slot] = std::move(definition);
+			slotStyleNames[slot] = name;
+		}
+		markSlotDirty(slot);
+	}
+
+	PatternEngine::StyleDefinitionPtr PatternEngine::getSlotStyleDefinition(int slot) const
+	{
+		if (slot < 0 || slot >= 8)
+			return nullptr;
+		const juce::ScopedLock sl(slotLock);
+		return slotStyleDefinitions[slot];
+	}
+
+	juce::String PatternEngine::getSlotStyleName(int slot) const
+	{
+		if (slot < 0 || slot >= 8)
+			return {};
+		const juce::ScopedLock sl(slotLock);
+		return slotStyleNames[slot];
+	}
+
+	PatternFeatures PatternEngine::getSlotFeatures(int slot) const
+	{
+		if (slot < 0 || slot >= 8)
+			return {};
+		const juce::ScopedLock sl(slotLock);
+		return slotFeatures[slot];
+	}
+
+	void PatternEngine::setSlotGrid(int slot, TimeSignature signature, int numBars)
+	{
+		if (slot < 0 || slot >= 8)
+			return;
+
+		{
+			const juce::ScopedLock sl(slotLock);
+			slotGrids[slot] = signature;
+			slotBars[slot] = juce::jlimit(1, juce::jmax(1, PlaybackPattern::maxSteps / signature.getStepsPerBar()), numBars);
+		}
+		resetSlot(slot);
+		ensureSlot(slot);
+	}
+
+	void PatternEngine::resetSlot(int slot)
+	{
+		if (slot < 0 || slot >= 8)
+			return;
+
+		{
+			const juce::ScopedLock sl(slotLock);
+			slots[slot].reset();
+			pendingSlotMask.fetch_or(1u << slot);
+			slotFeatures[slot] = {};
+		}
+		markSlotDirty(slot);
+	}
+
+	void PatternEngine::renderSlot(int slot)
+	{
+		auto& ladder = intensityLadders[slot].getWriteBuffer();
+		Pattern base{ "Playback" };
+		StyleDefinitionPtr style;
+		uint32_t seed;
+		{
+			const juce::ScopedLock sl(slotLock);
+			if (!slots[slot])
+				return;
+
+			base = *slots[slot];
+			style = slotStyleDefinitions[slot];
+			seed = slotRandomSeeds[slot];
+		}
+
+		for (int rung = 0; rung < intensityLadderRungs; ++rung)
+			ladder.rungs[rung].loadFrom(StyleManager::applyIntensity(base, getRungIntensity(rung), *style, seed));
+		ladder.rendered = true;
+
+		intensityLadders[slot].publish();
+
+		auto features = PatternFeatures::fromPattern(base);
+		const juce::ScopedLock sl(slotLock);
+		slotFeatures[slot] = features;
+	}
+
+	void PatternEngine::resetToStart()
+	{
+		currentStep = 0;
+		lastStepPpq = std::numeric_limits<double>::lowest();
 		isPlaying = true;
 	}
 
@@ -54,20 +307,59 @@ namespace BeatCrafter
 	void PatternEngine::stop()
 	{
 		isPlaying = false;
-		for (auto& slot : slots)
+		noteFlushPending = true;
+		currentStep = 0;
+	}
+
+	bool PatternEngine::postCommand(const Command& command)
+	{
+		const auto scope = commandFifo.write(1);
+		if (scope.blockSize1 + scope.blockSize2 == 0)
+			return false;
+
+		scope.forEach([this, &command](int index) { commandBuffer[(size_t)index] = command; });
+
+		if (command.type == CommandType::SwitchSlot && command.slot >= 0 && command.slot < 8)
 		{
-			if (slot)
-				slot->setCurrentStep(0);
+			displaySlot.store(command.slot);
+			renderThread.notify();
+		}
+		return true;
+	}
+
+	void PatternEngine::drainCommands()
+	{
+		const auto scope = commandFifo.read(commandFifo.getNumReady());
+		scope.forEach([this](int index) { applyCommand(commandBuffer[(size_t)index]); });
+	}
+
+	void PatternEngine::applyCommand(const Command& command)
+	{
+		switch (command.type)
+		{
+		case CommandType::SwitchSlot:
+			switchToSlot(command.slot, command.flag, command.value);
+			break;
+		case CommandType::SetLiveJamMode:
+			setLiveJamMode(command.flag);
+			break;
 		}
 	}
 
 	void PatternEngine::generateNewPatternForSlot(int slot, StyleType style, float complexity)
+	{
+		generateNewPatternForSlot(slot, StyleManager::getStyleDefinition(style), complexity);
+	}
+
+	void PatternEngine::generateNewPatternForSlot(int slot, const StyleTable::StyleDefinition& style, float complexity)
 	{
 		if (slot < 0 || slot >= 8)
 			return;
 
 		auto newPattern = std::make_unique<Pattern>("Generated " + juce::String(slot + 1));
-		StyleManager::generateBasicPattern(*newPattern, style);
+		newPattern->setTimeSignature(slotGrids[slot]);
+		newPattern->setNumBars(slotBars[slot]);
+		StyleManager::generateBasicPattern(*newPattern, style, slotRandomSeeds[slot]);
 		StyleManager::applyComplexityToPattern(*newPattern, style,
 			juce::jmax(0.1f, complexity),
 			slotRandomSeeds[slot]);
@@ -79,20 +371,31 @@ namespace BeatCrafter
 	{
 		if (slot >= 0 && slot < 8)
 		{
-			slots[slot] = std::move(pattern);
+			{
+				const juce::ScopedLock sl(slotLock);
+				if (pattern)
+				{
+					slotGrids[slot] = pattern->getTimeSignature();
+					slotBars[slot] = pattern->getNumBars();
+				}
+				slots[slot] = std::move(pattern);
+				pendingSlotMask.fetch_and(~(1u << slot));
+			}
+			markSlotDirty(slot);
 		}
 	}
 
 	void PatternEngine::switchToSlot(int slot, bool immediate, float intensity)
 	{
-		if (slot < 0 || slot >= 8 || !slots[slot])
+		if (slot < 0 || slot >= 8)
 			return;
 
 		if (intensity >= 0.0f)
 			currentIntensity = intensity;
 
-		intensifiedPatternCache = applyIntensity(*slots[slot], currentIntensity);
-		intensityCacheValid = true;
+		displaySlot.store(slot);
+		invalidateCache();
+		renderThread.notify();
 
 		if (immediate)
 		{
@@ -108,102 +411,275 @@ namespace BeatCrafter
 			queuedSlot = slot;
 	}
 	void PatternEngine::processBlock(juce::MidiBuffer& midiMessages,
-		int /*numSamples*/,
+		int numSamples,
 		double sampleRate,
 		const juce::AudioPlayHead::PositionInfo& posInfo)
 	{
 		midiMessages.clear();
-		if (!slots[activeSlot])
+		drainCommands();
+		if (!renderThread.isThreadRunning())
+		{
+			// Offline engines (drag export, CLI render) only build the slots playback can reach next.
+			for (int slot : { activeSlot.load(), pendingImmediateSlot.load(), queuedSlot })
+				if (slot >= 0 && slot < 8)
+					requestedSlotMask.fetch_or(1u << slot);
+			renderRequestedSlots();
+		}
+		if (numSamples <= 0 || sampleRate <= 0.0)
 			return;
+		if (noteFlushPending)
+		{
+			scheduledNotes.flush(midiMessages, 0);
+			noteFlushPending = false;
+		}
 		bool isPlayingDAW = posInfo.getIsPlaying();
 		double bpm = posInfo.getBpm().orFallback(120.0);
 		double ppqPosition = posInfo.getPpqPosition().orFallback(0.0);
-		int currentMeasure = static_cast<int>(ppqPosition / 4.0);
-
-		bool requestedTripletMode = perfParams.tripletMode;
-		bool modeChangePending = (requestedTripletMode != activeTripletMode);
-
-		double beatsPerSecond = bpm / 60.0;
-		double stepsPerBeat = activeTripletMode ? 3.0 : 4.0;
-		double stepsPerSecond = beatsPerSecond * stepsPerBeat;
-		samplesPerStep = static_cast<int>(sampleRate / stepsPerSecond);
-		auto& pattern = *slots[activeSlot];
-		int patternLength = pattern.getLength();
-		double ppqPerStep = activeTripletMode ? (1.0 / 3.0) : 0.25;
-		int effectiveLength = activeTripletMode ? 12 : patternLength;
-		int currentStepFromPPQ = static_cast<int>(ppqPosition / ppqPerStep) % effectiveLength;
+		const auto& activeRung = intensityLadders[activeSlot].getReadBuffer().rungs[0];
+		int currentMeasure = static_cast<int>(ppqPosition * activeRung.getStepsPerQuarter() / activeRung.getStepsPerBar());
+
+		double samplesPerPpq = sampleRate * 60.0 / juce::jmax(1.0, bpm);
+		double blockEndPpq = ppqPosition + numSamples / samplesPerPpq;
+
+		// Any jump away from where the previous block ended (relocation, loop,
+		// tempo ramp) restarts the step search at the playhead; notes already
+		// scheduled for the old timeline are dropped and emitted again.
+		if (std::abs(ppqPosition - expectedPpqPosition) > transportJumpTolerancePpq)
+		{
+			lastStepPpq = std::numeric_limits<double>::lowest();
+			scheduledNotes.releaseAll(blockStartSample);
+		}
+		expectedPpqPosition = isPlayingDAW ? blockEndPpq : ppqPosition;
+		currentSampleRate = sampleRate;
+
 		updateSurpriseMe(currentMeasure, ppqPosition);
-		if (currentStepFromPPQ != pattern.getCurrentStep() ||
-			(currentStepFromPPQ == 0 && ppqPosition < 0.1))
+		if (!isPlayingDAW)
 		{
-			pattern.setCurrentStep(currentStepFromPPQ);
+			scheduledNotes.flush(midiMessages, 0);
+			publishDisplaySnapshot();
+			return;
+		}
+
+		double searchPpq = ppqPosition;
+		double windowEndPpq = blockEndPpq + getLookAheadPpq();
+
+		while (true)
+		{
+			double ppqPerStep = getPpqPerStep();
+			double stepNumber = std::ceil(searchPpq / ppqPerStep - stepPpqTolerance);
+			double stepPpq = stepNumber * ppqPerStep;
+			if (stepPpq >= windowEndPpq)
+				break;
 
-			if (modeChangePending)
+			searchPpq = stepPpq + ppqPerStep * 0.5;
+			if (stepPpq <= lastStepPpq + stepPpqTolerance)
+				continue;
+			lastStepPpq = stepPpq;
+
+			double beatPhase = stepPpq - std::round(stepPpq);
+			if (perfParams.tripletMode != activeTripletMode && std::abs(beatPhase) < stepPpqTolerance)
 			{
-				activeTripletMode = requestedTripletMode;
-				ppqPerStep = activeTripletMode ? (1.0 / 3.0) : 0.25;
-				effectiveLength = activeTripletMode ? 12 : patternLength;
-				currentStepFromPPQ = static_cast<int>(ppqPosition / ppqPerStep) % effectiveLength;
-				pattern.setCurrentStep(currentStepFromPPQ);
+				activeTripletMode = perfParams.tripletMode;
+				ppqPerStep = getPpqPerStep();
+				searchPpq = stepPpq + ppqPerStep * 0.5;
 			}
 
-			int pending = pendingImmediateSlot.exchange(-1);
-			if (pending >= 0)
+			int newSamplesPerStep = static_cast<int>(samplesPerPpq * ppqPerStep);
+			if (newSamplesPerStep != samplesPerStep)
 			{
-				sendAllNotesOff(midiMessages);
-				activeSlot = pending;
-				queuedSlot = -1;
-				intensityCacheValid = false;
+				samplesPerStep = newSamplesPerStep;
+				timingOffsetsDirty = true;
 			}
-			else if (queuedSlot >= 0 && currentStepFromPPQ == 0)
+
+			juce::int64 stepSample = blockStartSample
+				+ static_cast<juce::int64>(std::llround((stepPpq - ppqPosition) * samplesPerPpq));
+			processStep(juce::jmax(blockStartSample, stepSample), stepPpq);
+		}
+
+		scheduledNotes.renderBlock(midiMessages, blockStartSample, numSamples);
+		blockStartSample += numSamples;
+		publishDisplaySnapshot();
+	}
+
+	void PatternEngine::publishDisplaySnapshot()
+	{
+		int slot = displaySlot.load();
+		auto& ladders = intensityLadders[slot];
+		bool ladderChanged = ladders.update();
+		if (ladderChanged && slot == activeSlot)
+			timingOffsetsDirty = true;
+
+		const auto& ladder = ladders.getReadBuffer();
+		if (!ladder.rendered)
+			return;
+
+		int rung = getLadderRung(currentIntensity);
+		int playhead = currentStep;
+		bool forced = displayDirty.exchange(false);
+		if (!forced && !ladderChanged && slot == publishedDisplaySlot
+			&& rung == publishedDisplayRung && playhead == publishedPlayhead)
+			return;
+
+		if (forced || ladderChanged || slot != publishedDisplaySlot || rung != publishedDisplayRung)
+			++displayPatternVersion;
+
+		auto& snapshot = displaySnapshots.getWriteBuffer();
+		snapshot.pattern = ladder.rungs[rung];
+		snapshot.playhead = playhead;
+		snapshot.slot = slot;
+		snapshot.patternVersion = displayPatternVersion;
+		snapshot.rendered = true;
+		displaySnapshots.publish();
+
+		publishedDisplaySlot = slot;
+		publishedDisplayRung = rung;
+		publishedPlayhead = playhead;
+	}
+
+	double PatternEngine::getPpqPerStep() const
+	{
+		double straight = 1.0 / intensityLadders[activeSlot].getReadBuffer().rungs[0].getStepsPerQuarter();
+		return activeTripletMode ? straight * 4.0 / 3.0 : straight;
+	}
+
+	double PatternEngine::getLookAheadPpq() const
+	{
+		// Sized for a triplet step, the longest the grid plays, so toggling
+		// triplet mode mid-window cannot push an early note out of it.
+		double straight = 1.0 / intensityLadders[activeSlot].getReadBuffer().rungs[0].getStepsPerQuarter();
+		return maxEarlyStepFraction * straight * 4.0 / 3.0;
+	}
+
+	void PatternEngine::processStep(juce::int64 stepSample, double stepPpq)
+	{
+		auto stepInPattern = [this, stepPpq]()
 			{
-				sendAllNotesOff(midiMessages);
-				activeSlot = queuedSlot;
-				queuedSlot = -1;
-				intensityCacheValid = false;
-			}
-			if (isPlayingDAW)
-				generateMidiForStep(midiMessages, 0, *slots[activeSlot], currentStepFromPPQ);
+				int length = getPlaybackLength(activeSlot);
+				int effectiveLength = activeTripletMode ? juce::jmax(1, length * 3 / 4) : length;
+				auto stepNumber = static_cast<juce::int64>(std::llround(stepPpq / getPpqPerStep()));
+				return static_cast<int>(((stepNumber % effectiveLength) + effectiveLength) % effectiveLength);
+			};
+
+		int stepIndex = stepInPattern();
+
+		// An immediate switch still waits for the target's ladder, like a queued
+		// one, so the current slot keeps playing instead of going silent. The
+		// request is put back unless a newer one replaced it meanwhile.
+		int pending = pendingImmediateSlot.exchange(-1);
+		if (pending >= 0 && !isLadderReady(pending))
+		{
+			int none = -1;
+			pendingImmediateSlot.compare_exchange_strong(none, pending);
+			pending = -1;
+		}
+
+		if (pending >= 0)
+		{
+			scheduledNotes.releaseAll(stepSample);
+			activeSlot = pending;
+			queuedSlot = -1;
+			displaySlot.store(pending);
+			timingOffsetsDirty = true;
+			stepIndex = stepInPattern();
+		}
+		else if (queuedSlot >= 0 && stepIndex == 0 && isLadderReady(queuedSlot))
+		{
+			scheduledNotes.releaseAll(stepSample);
+			activeSlot = queuedSlot;
+			queuedSlot = -1;
+			displaySlot.store(activeSlot);
+			timingOffsetsDirty = true;
+		}
+
+		currentStep = stepIndex;
+
+		auto& ladders = intensityLadders[activeSlot];
+		if (ladders.update())
+		{
+			timingOffsetsDirty = true;
+			displayDirty.store(true);
 		}
-		lastPpqPosition = ppqPosition;
-		int displaySlot = pendingImmediateSlot.load() >= 0
-			? pendingImmediateSlot.load()
-			: activeSlot;
-		if (!intensityCacheValid && slots[displaySlot])
+		const auto& ladder = ladders.getReadBuffer();
+		if (!ladder.rendered)
+			return;
+
+		int rung = getLadderRung(currentIntensity);
+		if (rung != activeRung)
+		{
+			activeRung = rung;
+			timingOffsetsDirty = true;
+		}
+		const auto& playback = ladder.rungs[rung];
+
+		if (timingOffsetsDirty)
+			updateTimingOffsets(playback);
+
+		generateMidiForStep(stepSample, playback, stepIndex);
+	}
+
+	bool PatternEngine::isLadderReady(int slot)
+	{
+		intensityLadders[slot].update();
+		return intensityLadders[slot].getReadBuffer().rendered;
+	}
+
+	void PatternEngine::updateTimingOffsets(const PlaybackPattern& pattern)
+	{
+		int numTracks = pattern.getNumTracks();
+		int numSteps = pattern.getLength();
+
+		// Swing delays the off-beat 16ths by a fraction of a 16th, whatever the
+		// grid resolution; triplet grids have no 16th lattice and stay straight.
+		bool hasSixteenthGrid = !activeTripletMode && pattern.getStepsPerQuarter() % 4 == 0;
+		int stepsPerSixteenth = pattern.getStepsPerQuarter() / 4;
+		int swingSamples = hasSixteenthGrid
+			? static_cast<int>(pattern.getSwing() * swingStepFraction * samplesPerStep * stepsPerSixteenth)
+			: 0;
+		int earliestOffset = -static_cast<int>(maxEarlyStepFraction * samplesPerStep);
+
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
 		{
-			intensifiedPatternCache = applyIntensity(*slots[displaySlot], currentIntensity);
-			intensityCacheValid = true;
+			for (int stepIdx = 0; stepIdx < numSteps; ++stepIdx)
+			{
+				int sixteenth = hasSixteenthGrid ? pattern.getSixteenthInBar(stepIdx) : -1;
+				int offset = (sixteenth >= 0 && sixteenth % 2 == 1) ? swingSamples : 0;
+				offset += static_cast<int>(pattern.getMicroTiming(trackIdx, stepIdx) * samplesPerStep);
+				stepTimingOffsets[trackIdx][stepIdx] = juce::jmax(earliestOffset, offset);
+			}
 		}
+
+		timingOffsetsDirty = false;
 	}
-	void PatternEngine::applyHumanization(Pattern& pattern, int stepIndex)
+
+	void PatternEngine::applyHumanization(Step* column, int numTracks, int beatInBar)
 	{
-		static std::mt19937 rng(std::random_device{}());
-		std::uniform_real_distribution<float> velDist(
-			-perfParams.humanizeAmount, perfParams.humanizeAmount);
-		std::uniform_real_distribution<float> chanceDist(0.0f, 1.0f);
+		std::array<uint32_t, maxColumnTracks> active{};
+		std::array<float, maxColumnTracks> velocity{}, velocityOffsets{}, omitDraws{}, omitChances{};
 
-		for (int trackIdx = 0; trackIdx < pattern.getNumTracks(); ++trackIdx)
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
 		{
-			auto& step = pattern.getTrack(trackIdx).getStep(stepIndex);
+			const auto& step = column[trackIdx];
+			active[trackIdx] = step.isActive() ? 1u : 0u;
+			velocity[trackIdx] = step.getVelocity();
 			if (!step.isActive())
 				continue;
 
-			float newVel = juce::jlimit(0.15f, 1.0f,
-				step.getVelocity() + velDist(rng));
-			step.setVelocity(newVel);
+			velocityOffsets[trackIdx] = playbackRandom.nextFloat(-perfParams.humanizeAmount, perfParams.humanizeAmount);
 
 			float omitProb = perfParams.omitChance;
+			bool onBeat = beatInBar >= 0;
 
+			// Kick holds the downbeat and every other beat, snare the beats between.
 			if (trackIdx == 0)
 			{
-				if (stepIndex == 0 || stepIndex == 8)
+				if (onBeat && beatInBar % 2 == 0)
 					omitProb *= 0.1f;
 				else
 					omitProb *= 0.5f;
 			}
 			else if (trackIdx == 1)
 			{
-				if (stepIndex == 4 || stepIndex == 12)
+				if (onBeat && beatInBar % 2 == 1)
 					omitProb *= 0.15f;
 				else
 					omitProb *= 0.6f;
@@ -217,21 +693,21 @@ namespace BeatCrafter
 				omitProb *= 2.5f;
 			}
 
-			if (chanceDist(rng) < omitProb)
-				step.setActive(false);
+			omitChances[trackIdx] = omitProb;
+			omitDraws[trackIdx] = playbackRandom.nextFloat();
 		}
-	}
 
-	void PatternEngine::sendAllNotesOff(juce::MidiBuffer& midiMessages)
-	{
-		for (int ch = 1; ch <= 16; ++ch)
+		StepKernels::humanize(active.data(), velocity.data(), velocityOffsets.data(),
+			omitDraws.data(), omitChances.data(), numTracks, 0.15f);
+
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
 		{
-			midiMessages.addEvent(juce::MidiMessage::allNotesOff(ch), 0);
-			midiMessages.addEvent(juce::MidiMessage::allSoundOff(ch), 0);
+			column[trackIdx].setActive(active[trackIdx] != 0);
+			column[trackIdx].setVelocity(velocity[trackIdx]);
 		}
 	}
 
-	void PatternEngine::addLiveJamElements(Pattern& pattern, int stepIndex, float /*intensity*/)
+	void PatternEngine::addLiveJamElements(Step* column, int numTracks, int stepIndex, float /*intensity*/)
 	{
 		stepsSinceLastJam++;
 
@@ -248,23 +724,23 @@ namespace BeatCrafter
 			switch (elementType)
 			{
 			case 0:
-				if (!pattern.getTrack(0).getStep(stepIndex).isActive())
+				if (!column[0].isActive())
 				{
-					pattern.getTrack(0).getStep(stepIndex).setActive(true);
-					pattern.getTrack(0).getStep(stepIndex).setVelocity(
+					column[0].setActive(true);
+					column[0].setVelocity(
 						0.4f + currentLiveJamIntensity * 0.5f);
-					pattern.getTrack(0).getStep(stepIndex).setProbability(
+					column[0].setProbability(
 						0.6f + currentLiveJamIntensity * 0.3f);
 				}
 				break;
 
 			case 1:
-				if (!pattern.getTrack(1).getStep(stepIndex).isActive())
+				if (!column[1].isActive())
 				{
-					pattern.getTrack(1).getStep(stepIndex).setActive(true);
-					pattern.getTrack(1).getStep(stepIndex).setVelocity(
+					column[1].setActive(true);
+					column[1].setVelocity(
 						0.2f + liveJamRandom.nextFloat() * currentLiveJamIntensity * 0.4f);
-					pattern.getTrack(1).getStep(stepIndex).setProbability(
+					column[1].setProbability(
 						0.5f + currentLiveJamIntensity * 0.4f);
 				}
 				break;
@@ -272,29 +748,29 @@ namespace BeatCrafter
 			case 2:
 				if (stepIndex % 4 == 0 || stepIndex % 8 == 0)
 				{
-					pattern.getTrack(4).getStep(stepIndex).setActive(true);
-					pattern.getTrack(4).getStep(stepIndex).setVelocity(
+					column[4].setActive(true);
+					column[4].setVelocity(
 						0.5f + currentLiveJamIntensity * 0.4f);
-					pattern.getTrack(4).getStep(stepIndex).setProbability(
+					column[4].setProbability(
 						0.4f + currentLiveJamIntensity * 0.4f);
 				}
 				break;
 
 			case 3:
-				pattern.getTrack(3).getStep(stepIndex).setActive(true);
-				pattern.getTrack(3).getStep(stepIndex).setVelocity(
+				column[3].setActive(true);
+				column[3].setVelocity(
 					0.3f + currentLiveJamIntensity * 0.4f);
-				pattern.getTrack(3).getStep(stepIndex).setProbability(
+				column[3].setProbability(
 					0.6f + currentLiveJamIntensity * 0.3f);
 				break;
 
 			case 4:
 				if (currentLiveJamIntensity > 0.4f && stepIndex % 4 == 0)
 				{
-					pattern.getTrack(10).getStep(stepIndex).setActive(true);
-					pattern.getTrack(10).getStep(stepIndex).setVelocity(
+					column[10].setActive(true);
+					column[10].setVelocity(
 						0.5f + currentLiveJamIntensity * 0.4f);
-					pattern.getTrack(10).getStep(stepIndex).setProbability(
+					column[10].setProbability(
 						0.3f + currentLiveJamIntensity * 0.5f);
 				}
 				break;
@@ -302,10 +778,10 @@ namespace BeatCrafter
 			case 5:
 				if (currentLiveJamIntensity > 0.3f)
 				{
-					pattern.getTrack(5).getStep(stepIndex).setActive(true);
-					pattern.getTrack(5).getStep(stepIndex).setVelocity(
+					column[5].setActive(true);
+					column[5].setVelocity(
 						0.3f + currentLiveJamIntensity * 0.5f);
-					pattern.getTrack(5).getStep(stepIndex).setProbability(
+					column[5].setProbability(
 						0.5f + currentLiveJamIntensity * 0.4f);
 				}
 				break;
@@ -313,10 +789,10 @@ namespace BeatCrafter
 			case 6:
 				if (currentLiveJamIntensity > 0.4f && stepIndex % 2 == 0)
 				{
-					pattern.getTrack(0).getStep(stepIndex).setActive(true);
-					pattern.getTrack(0).getStep(stepIndex).setVelocity(
+					column[0].setActive(true);
+					column[0].setVelocity(
 						0.6f + liveJamRandom.nextFloat() * currentLiveJamIntensity * 0.3f);
-					pattern.getTrack(0).getStep(stepIndex).setProbability(
+					column[0].setProbability(
 						0.5f + currentLiveJamIntensity * 0.4f);
 				}
 				break;
@@ -324,27 +800,21 @@ namespace BeatCrafter
 			case 7:
 				if (currentLiveJamIntensity > 0.4f)
 				{
-					pattern.getTrack(1).getStep(stepIndex).setActive(true);
-					pattern.getTrack(1).getStep(stepIndex).setVelocity(
+					column[1].setActive(true);
+					column[1].setVelocity(
 						0.3f + liveJamRandom.nextFloat() * 0.4f);
-					pattern.getTrack(1).getStep(stepIndex).setProbability(
+					column[1].setProbability(
 						0.4f + currentLiveJamIntensity * 0.5f);
-					if (stepIndex < 15)
-					{
-						pattern.getTrack(1).getStep(stepIndex + 1).setActive(true);
-						pattern.getTrack(1).getStep(stepIndex + 1).setVelocity(0.15f + liveJamRandom.nextFloat() * 0.2f);
-						pattern.getTrack(1).getStep(stepIndex + 1).setProbability(0.4f + currentLiveJamIntensity * 0.3f);
-					}
 				}
 				break;
 
 			case 8:
 				if (currentLiveJamIntensity > 0.7f)
 				{
-					pattern.getTrack(9).getStep(stepIndex).setActive(true);
-					pattern.getTrack(9).getStep(stepIndex).setVelocity(
+					column[9].setActive(true);
+					column[9].setVelocity(
 						0.4f + liveJamRandom.nextFloat() * currentLiveJamIntensity * 0.4f);
-					pattern.getTrack(9).getStep(stepIndex).setProbability(
+					column[9].setProbability(
 						0.6f + currentLiveJamIntensity * 0.3f);
 				}
 				break;
@@ -352,10 +822,10 @@ namespace BeatCrafter
 			case 9:
 				if (currentLiveJamIntensity > 0.7f)
 				{
-					pattern.getTrack(11).getStep(stepIndex).setActive(true);
-					pattern.getTrack(11).getStep(stepIndex).setVelocity(
+					column[11].setActive(true);
+					column[11].setVelocity(
 						0.5f + liveJamRandom.nextFloat() * currentLiveJamIntensity * 0.4f);
-					pattern.getTrack(11).getStep(stepIndex).setProbability(
+					column[11].setProbability(
 						0.3f + currentLiveJamIntensity * 0.5f);
 				}
 				break;
@@ -366,30 +836,22 @@ namespace BeatCrafter
 			liveJamRandom.nextFloat() < currentLiveJamIntensity * 0.5f)
 		{
 			int tomTrack = liveJamRandom.nextBool() ? 6 : 7;
-			pattern.getTrack(tomTrack).getStep(stepIndex).setActive(true);
-			pattern.getTrack(tomTrack).getStep(stepIndex).setVelocity(
+			column[tomTrack].setActive(true);
+			column[tomTrack].setVelocity(
 				0.4f + liveJamRandom.nextFloat() * currentLiveJamIntensity * 0.5f);
-			pattern.getTrack(tomTrack).getStep(stepIndex).setProbability(
+			column[tomTrack].setProbability(
 				0.6f + currentLiveJamIntensity * 0.3f);
-
-			if (currentLiveJamIntensity > 0.8f && stepIndex < 15)
-			{
-				int otherTom = (tomTrack == 6) ? 7 : 6;
-				pattern.getTrack(otherTom).getStep(stepIndex + 1).setActive(true);
-				pattern.getTrack(otherTom).getStep(stepIndex + 1).setVelocity(0.5f + liveJamRandom.nextFloat() * 0.3f);
-				pattern.getTrack(otherTom).getStep(stepIndex + 1).setProbability(0.7f + currentLiveJamIntensity * 0.2f);
-			}
 		}
 
 		if (currentLiveJamIntensity > 0.6f &&
 			liveJamRandom.nextFloat() < currentLiveJamIntensity * 0.25f)
 		{
-			if (!pattern.getTrack(2).getStep(stepIndex).isActive())
+			if (!column[2].isActive())
 			{
-				pattern.getTrack(2).getStep(stepIndex).setActive(true);
-				pattern.getTrack(2).getStep(stepIndex).setVelocity(
+				column[2].setActive(true);
+				column[2].setVelocity(
 					0.2f + currentLiveJamIntensity * 0.3f);
-				pattern.getTrack(2).getStep(stepIndex).setProbability(
+				column[2].setProbability(
 					0.7f + currentLiveJamIntensity * 0.2f);
 			}
 		}
@@ -397,77 +859,86 @@ namespace BeatCrafter
 		if (currentLiveJamIntensity > 0.9f &&
 			liveJamRandom.nextFloat() < 0.3f)
 		{
-			int randomTrack = liveJamRandom.nextInt(pattern.getNumTracks());
-			if (!pattern.getTrack(randomTrack).getStep(stepIndex).isActive())
+			int randomTrack = liveJamRandom.nextInt(numTracks);
+			if (!column[randomTrack].isActive())
 			{
-				pattern.getTrack(randomTrack).getStep(stepIndex).setActive(true);
-				pattern.getTrack(randomTrack).getStep(stepIndex).setVelocity(0.3f + liveJamRandom.nextFloat() * 0.5f);
-				pattern.getTrack(randomTrack).getStep(stepIndex).setProbability(0.5f + liveJamRandom.nextFloat() * 0.4f);
+				column[randomTrack].setActive(true);
+				column[randomTrack].setVelocity(0.3f + liveJamRandom.nextFloat() * 0.5f);
+				column[randomTrack].setProbability(0.5f + liveJamRandom.nextFloat() * 0.4f);
 			}
 		}
 	}
 
-	void PatternEngine::generateMidiForStep(juce::MidiBuffer& midiMessages,
-		int samplePosition,
-		const Pattern& pattern,
+	void PatternEngine::generateMidiForStep(juce::int64 stepSample,
+		const PlaybackPattern& pattern,
 		int stepIndex)
 	{
-		cachedIntensifiedPattern = applyIntensity(pattern, currentIntensity);
+		int numTracks = pattern.getNumTracks();
+		bool inPattern = stepIndex < pattern.getLength();
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
+		{
+			auto& step = stepColumn[trackIdx];
+			step = Step();
+			if (inPattern && pattern.isActive(trackIdx, stepIndex))
+			{
+				step.setActive(true);
+				step.setVelocity(pattern.getVelocity(trackIdx, stepIndex));
+				step.setProbability(pattern.getProbability(trackIdx, stepIndex));
+				step.setMicroTiming(pattern.getMicroTiming(trackIdx, stepIndex));
+			}
+		}
 
+		int barPosition = pattern.getSixteenthInBar(stepIndex);
 		if (liveJamMode && currentLiveJamIntensity > 0.1f)
-			addLiveJamElements(cachedIntensifiedPattern, stepIndex, currentIntensity);
+			addLiveJamElements(stepColumn.data(), numTracks, barPosition, currentIntensity);
 
 		if (perfParams.humanizeEnabled)
-			applyHumanization(cachedIntensifiedPattern, stepIndex);
-
-		static std::mt19937 gen(std::random_device{}());
-		static std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+			applyHumanization(stepColumn.data(), numTracks, pattern.getBeatInBar(stepIndex));
 
-		for (int trackIdx = 0; trackIdx < cachedIntensifiedPattern.getNumTracks(); ++trackIdx)
+		int timingStep = juce::jmin(stepIndex, maxTimingSteps - 1);
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
 		{
-			const auto& track = cachedIntensifiedPattern.getTrack(trackIdx);
-			const auto* step = track.getStep(stepIndex);
+			const auto& step = stepColumn[trackIdx];
 
-			if (step) {
-				if (step->isActive() && dis(gen) <= step->getProbability())
-				{
-					int midiNote = track.getMidiNote();
-					int velocity = static_cast<int>(step->getVelocity() * 127.0f);
-					int timingOffset = static_cast<int>(step->getMicroTiming() * samplesPerStep * 0.1f);
-					int finalSamplePos = juce::jmax(0, samplePosition + timingOffset);
-
-					midiMessages.addEvent(
-						juce::MidiMessage::noteOn(10, midiNote, (juce::uint8)velocity),
-						finalSamplePos);
-					midiMessages.addEvent(
-						juce::MidiMessage::noteOff(10, midiNote),
-						juce::jmin(finalSamplePos + (int)(0.1 * 44100),
-							samplePosition + samplesPerStep - 1));
-				}
+			if (step.isActive() && playbackRandom.nextFloat() <= step.getProbability())
+			{
+				int midiNote = pattern.getMidiNote(trackIdx);
+				int velocity = static_cast<int>(step.getVelocity() * 127.0f);
+				juce::int64 noteOnSample = juce::jmax(blockStartSample,
+					stepSample + stepTimingOffsets[trackIdx][timingStep]);
+				auto gateSamples = static_cast<juce::int64>(
+					GMDrum::getGateLengthMs(midiNote) * 0.001 * currentSampleRate);
+
+				scheduledNotes.schedule(GMDrum::CHANNEL, midiNote, (juce::uint8)velocity,
+					noteOnSample, noteOnSample + gateSamples);
 			}
 		}
 	}
 
 	Pattern PatternEngine::applyIntensity(const Pattern& basePattern, float intensity) const
 	{
-		StyleType currentStyle = getSlotStyle(activeSlot);
+		auto currentStyle = getSlotStyleDefinition(activeSlot);
 		uint32_t currentSeed = slotRandomSeeds[activeSlot];
-		return StyleManager::applyIntensity(basePattern, intensity, currentStyle, currentSeed);
+		return StyleManager::applyIntensity(basePattern, intensity, *currentStyle, currentSeed);
 	}
 
 	void PatternEngine::generateNewPattern(StyleType style, float complexity)
 	{
-		if (!slots[activeSlot])
-			slots[activeSlot] = std::make_unique<Pattern>("Generated");
+		{
+			const juce::ScopedLock sl(slotLock);
+			if (!slots[activeSlot])
+				slots[activeSlot] = std::make_unique<Pattern>("Generated");
+			pendingSlotMask.fetch_and(~(1u << activeSlot));
 
-		auto& pattern = *slots[activeSlot];
-		StyleManager::generateBasicPattern(pattern, style);
+			auto& pattern = *slots[activeSlot];
+			StyleManager::generateBasicPattern(pattern, style, slotRandomSeeds[activeSlot]);
 
-		StyleManager::applyComplexityToPattern(pattern, style,
-			juce::jmax(0.1f, complexity),
-			slotRandomSeeds[activeSlot]);
+			StyleManager::applyComplexityToPattern(pattern, style,
+				juce::jmax(0.1f, complexity),
+				slotRandomSeeds[activeSlot]);
+		}
 
-		intensityCacheValid = false;
+		markSlotDirty(activeSlot);
 	}
 
 	void PatternEngine::updateSurpriseMe(int currentMeasure, double ppqPosition)
@@ -484,12 +955,8 @@ namespace BeatCrafter
 
 			if (currentMeasure % 8 == 0)
 			{
-				static std::mt19937 rng(std::random_device{}());
-				std::uniform_real_distribution<float> freqDist(0.4f, 1.2f);
-				std::uniform_real_distribution<float> ampDist(0.03f, 0.10f);
-
-				surpriseMeTargetFreq = freqDist(rng);
-				surpriseMeTargetAmplitude = ampDist(rng);
+				surpriseMeTargetFreq = playbackRandom.nextFloat(0.4f, 1.2f);
+				surpriseMeTargetAmplitude = playbackRandom.nextFloat(0.03f, 0.10f);
 
 				if (surpriseMeCenter < 0.2f)
 					surpriseMeCenter += 0.1f;
@@ -3,8 +3,16 @@
 #include <juce_audio_basics/juce_audio_basics.h>
 #include "Pattern.h"
 #include "StyleManager.h"
+#include "NoteScheduler.h"
+#include "PlaybackPattern.h"
+#include "PatternFeatures.h"
+#include "TripleBuffer.h"
+#include "RandomState.h"
 #include <array>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <random>
 
 namespace BeatCrafter
@@ -22,32 +30,69 @@ namespace BeatCrafter
 			float surpriseMeRange = 0.15f;
 		};
 
-		PatternEngine();
-		~PatternEngine() = default;
+		// Intensity, chaos, Surprise Me and triplets are host parameters; the processor pushes
+		// them through the performance setters each block rather than through commands.
+		enum class CommandType
+		{
+			SwitchSlot,
+			SetLiveJamMode
+		};
 
-		Pattern& getCurrentPattern() { return slots[activeSlot] ? *slots[activeSlot] : dummyPattern; }
-		const Pattern& getCurrentPattern() const { return *slots[activeSlot]; }
-		const Pattern* getDisplayPattern() const { return &intensifiedPatternCache; }
-		Pattern* getCurrentBasePattern() { return slots[activeSlot].get(); }
-		Pattern* getSlot(int index) { return (index >= 0 && index < 8 && slots[index]) ? slots[index].get() : nullptr; }
+		struct Command
+		{
+			CommandType type = CommandType::SwitchSlot;
+			int slot = -1;
+			float value = 0.0f;
+			bool flag = false;
+		};
 
-		PerformanceParams perfParams;
+		struct DisplaySnapshot
+		{
+			DisplaySnapshot() { pattern.reserveForMaxSize(); }
+
+			PlaybackPattern pattern;
+			int playhead = -1;
+			int slot = 0;
+			uint32_t patternVersion = 0;
+			bool rendered = false;
+		};
+
+		PatternEngine();
+		~PatternEngine();
+
+		bool updateDisplaySnapshot() { return displaySnapshots.update(); }
+		const DisplaySnapshot& getDisplaySnapshot() const { return displaySnapshots.getReadBuffer(); }
+		// Slots are replaced by the render thread, so other threads only ever get a copy.
+		std::optional<Pattern> copySlot(int slot) const;
+		bool hasSlot(int index) const { return index >= 0 && index < 8 && (slots[index] || (pendingSlotMask.load() & (1u << index)) != 0); }
+		// Generates a pending slot in place; message and render threads only.
+		void ensureSlot(int slot);
+		// Audio-thread safe: flags a pending slot for the render thread to generate first.
+		void requestSlot(int slot);
+		void resetSlot(int slot);
 
 		void loadPatternToSlot(std::unique_ptr<Pattern> pattern, int slot);
 		void generateNewPattern(StyleType style, float complexity = 0.5f);
 		void generateNewPatternForSlot(int slot, StyleType style, float complexity = 0.5f);
+		void generateNewPatternForSlot(int slot, const StyleTable::StyleDefinition& style, float complexity = 0.5f);
 		Pattern applyIntensity(const Pattern& basePattern, float intensity) const;
 
 		void switchToSlot(int slot, bool immediate = false, float intensity = -1.0f);
 		int getActiveSlot() const { return activeSlot; }
-		int getCurrentStep() const { return slots[activeSlot] ? slots[activeSlot]->getCurrentStep() : -1; }
+		int getCurrentStep() const { return currentStep; }
 
-		void setSlotStyle(int slot, StyleType style)
-		{
-			if (slot >= 0 && slot < 8)
-				slotStyles[slot] = style;
-		}
+		using StyleDefinitionPtr = std::shared_ptr<const StyleTable::StyleDefinition>;
+
+		void setSlotStyle(int slot, StyleType style);
+		// Uses a definition from a StylePack; name is kept for display and state.
+		void setSlotStyle(int slot, StyleDefinitionPtr definition, const juce::String& name);
 		StyleType getSlotStyle(int slot) const { return (slot >= 0 && slot < 8) ? slotStyles[slot] : StyleType::Rock; }
+		StyleDefinitionPtr getSlotStyleDefinition(int slot) const;
+		// Empty for built-in styles.
+		juce::String getSlotStyleName(int slot) const;
+		// Features of the slot's base pattern, refreshed whenever the slot is rendered.
+		PatternFeatures getSlotFeatures(int slot) const;
+		void setSlotGrid(int slot, TimeSignature signature, int numBars);
 		StyleType getCurrentSlotStyle() const { return slotStyles[activeSlot]; }
 
 		std::function<void(float)> onIntensityChanged;
@@ -57,62 +102,145 @@ namespace BeatCrafter
 			if (slot >= 0 && slot < 8)
 			{
 				std::random_device rd;
+				const juce::ScopedLock sl(slotLock);
 				slotRandomSeeds[slot] = rd();
+				markSlotDirty(slot);
 			}
 		}
 		uint32_t getSlotSeed(int slot) const { return (slot >= 0 && slot < 8) ? slotRandomSeeds[slot] : 0; }
 		void setSlotSeed(int slot, uint32_t seed)
 		{
 			if (slot >= 0 && slot < 8)
+			{
+				const juce::ScopedLock sl(slotLock);
 				slotRandomSeeds[slot] = seed;
+				markSlotDirty(slot);
+			}
 		}
 
 		void setIntensity(float intensity)
 		{
 			if (std::abs(currentIntensity - intensity) > 0.001f)
 			{
+				bool rungChanged = getLadderRung(currentIntensity) != getLadderRung(intensity);
 				currentIntensity = intensity;
-				intensityCacheValid = false;
+				if (rungChanged)
+					invalidateCache();
 			}
 		}
 		float getIntensity() const { return currentIntensity; }
-		void invalidateCache() { intensityCacheValid = false; }
+		void invalidateCache();
+
+		uint32_t consumeStateDirtySlots() { return stateDirtySlotMask.exchange(0); }
+
+		void setBackgroundRendering(bool shouldRenderInBackground);
+		bool isBackgroundRendering() const { return renderThread.isThreadRunning(); }
 
 		void setLiveJamMode(bool enabled) { liveJamMode = enabled; }
 		void setLiveJamIntensity(float intensity) { currentLiveJamIntensity = intensity; }
 		float getLiveJamIntensity() const { return currentLiveJamIntensity; }
 
+		// Performance setters belong to the thread that calls processBlock.
+		void setSurpriseMeEnabled(bool enabled) { perfParams.surpriseMeEnabled = enabled; }
+		void setTripletMode(bool enabled) { perfParams.tripletMode = enabled; }
+		void setHumanizeEnabled(bool enabled) { perfParams.humanizeEnabled = enabled; }
+
 		void start();
 		void stop();
 		void resetToStart();
 		bool getIsPlaying() const { return isPlaying; }
 
+		void setPlaybackSeed(uint64_t seed)
+		{
+			playbackRandom.setSeed(seed);
+			liveJamRandom.setSeed((juce::int64)seed);
+		}
+		// How far past the block end steps are scheduled, so notes pulled early by
+		// micro-timing land in the right block; follows the active slot's grid.
+		double getLookAheadPpq() const;
+
+		bool postCommand(const Command& command);
+
 		void processBlock(juce::MidiBuffer& midiMessages,
 			int numSamples,
 			double sampleRate,
 			const juce::AudioPlayHead::PositionInfo& posInfo);
 
 	private:
+		static constexpr int intensityLadderRungs = 21;
+
+		struct IntensityLadder
+		{
+			std::array<PlaybackPattern, intensityLadderRungs> rungs;
+			bool rendered = false;
+		};
+
+		class RenderThread : public juce::Thread
+		{
+		public:
+			explicit RenderThread(PatternEngine& e) : juce::Thread("BeatCrafter Renderer"), engine(e) {}
+			~RenderThread() override { stopThread(1000); }
+			void run() override;
+
+		private:
+			PatternEngine& engine;
+		};
+
+		static constexpr int maxColumnTracks = PlaybackPattern::maxTracks;
+		static constexpr int maxRenderIdleWaitMs = 16;
+		static constexpr int prewarmDelayMs = 50;
+		static constexpr int commandCapacity = 256;
+
 		std::array<std::unique_ptr<Pattern>, 8> slots;
 		std::array<StyleType, 8> slotStyles;
+		std::array<StyleDefinitionPtr, 8> slotStyleDefinitions;
+		std::array<juce::String, 8> slotStyleNames;
+		std::array<PatternFeatures, 8> slotFeatures;
 		std::array<uint32_t, 8> slotRandomSeeds;
-		int activeSlot = 0;
+		std::array<TimeSignature, 8> slotGrids;
+		std::array<int, 8> slotBars;
+		std::atomic<int> activeSlot{ 0 };
+		std::atomic<int> currentStep{ -1 };
 		int queuedSlot = -1;
+		PerformanceParams perfParams;
 		bool activeTripletMode = false;
-		mutable Pattern intensifiedPatternCache;
-		mutable Pattern cachedIntensifiedPattern;
-		mutable bool intensityCacheValid = false;
-		mutable float lastCachedIntensity = -1.0f;
-		mutable int lastCachedSlot = -1;
-		Pattern dummyPattern{ "Empty" };
-
-		float currentIntensity = -1.0f;
+
+		std::array<TripleBuffer<IntensityLadder>, 8> intensityLadders;
+		std::array<Step, maxColumnTracks> stepColumn;
+		std::atomic<uint32_t> dirtySlotMask{ 0 };
+		std::atomic<uint32_t> pendingSlotMask{ 0xffu };
+		std::atomic<uint32_t> requestedSlotMask{ 0 };
+		std::atomic<uint32_t> stateDirtySlotMask{ 0xffu };
+		std::atomic<bool> displayDirty{ true };
+		TripleBuffer<DisplaySnapshot> displaySnapshots;
+		int publishedDisplaySlot = -1;
+		int publishedDisplayRung = -1;
+		int publishedPlayhead = -2;
+		uint32_t displayPatternVersion = 0;
+		std::atomic<int> displaySlot{ 0 };
+		juce::CriticalSection slotLock;
+
+		std::atomic<float> currentIntensity{ -1.0f };
 		float currentLiveJamIntensity = 0.5f;
 
+		static constexpr double stepPpqTolerance = 1.0e-6;
+		static constexpr double transportJumpTolerancePpq = 1.0e-4;
+		static constexpr int maxTimingSteps = PlaybackPattern::maxSteps;
+		static constexpr double swingStepFraction = 0.5;
+		static constexpr double maxEarlyStepFraction = 0.5;
+
 		bool isPlaying = false;
-		double lastPpqPosition = 0.0;
+		double expectedPpqPosition = 0.0;
+		double lastStepPpq = std::numeric_limits<double>::lowest();
 		int samplesPerStep = 0;
-		int sampleCounter = 0;
+		double currentSampleRate = 44100.0;
+		juce::int64 blockStartSample = 0;
+		bool noteFlushPending = false;
+		NoteScheduler scheduledNotes;
+		RandomState playbackRandom;
+		std::array<std::array<int, maxTimingSteps>, maxColumnTracks> stepTimingOffsets{};
+		bool timingOffsetsDirty = true;
+		int activeRung = -1;
 
 		float surpriseMeCenter = 0.5f;
 		float surpriseMePhase = 0.0f;
@@ -128,13 +256,39 @@ namespace BeatCrafter
 
 		std::atomic<int> pendingImmediateSlot{ -1 };
 
-		void generateMidiForStep(juce::MidiBuffer& midiMessages,
-			int samplePosition,
-			const Pattern& pattern,
+		juce::AbstractFifo commandFifo{ commandCapacity };
+		std::array<Command, commandCapacity> commandBuffer;
+
+		void drainCommands();
+		void applyCommand(const Command& command);
+		int getPlaybackLength(int slot) const { return intensityLadders[slot].getReadBuffer().rungs[0].getLength(); }
+		double getPpqPerStep() const;
+		void processStep(juce::int64 stepSample, double stepPpq);
+		bool isLadderReady(int slot);
+		void publishDisplaySnapshot();
+		void updateTimingOffsets(const PlaybackPattern& pattern);
+		void generateMidiForStep(juce::int64 stepSample,
+			const PlaybackPattern& pattern,
 			int stepIndex);
-		void addLiveJamElements(Pattern& pattern, int stepIndex, float intensity);
-		void sendAllNotesOff(juce::MidiBuffer& midiMessages);
-		void applyHumanization(Pattern& pattern, int stepIndex);
+		void addLiveJamElements(Step* column, int numTracks, int stepIndex, float intensity);
+		void applyHumanization(Step* column, int numTracks, int beatInBar);
 		void updateSurpriseMe(int currentMeasure, double ppqPosition);
+
+		void markSlotDirty(int slot);
+		bool renderRequestedSlots();
+		bool renderDirtySlots();
+		void generateSlot(int slot);
+		static int getSlotByPriority(int centre, int order);
+
+		// Rung k covers [k/20, (k+1)/20), so an intensity never plays the band below its threshold.
+		static int getLadderRung(float intensity)
+		{
+			return juce::jlimit(0, intensityLadderRungs - 1,
+				(int)std::floor(intensity * (float)(intensityLadderRungs - 1) + 1.0e-6f));
+		}
+		static float getRungIntensity(int rung) { return (float)rung / (float)(intensityLadderRungs - 1); }
+		void renderSlot(int slot);
+
+		RenderThread renderThread{ *this };
 	};
 }
\ No newline at end of file
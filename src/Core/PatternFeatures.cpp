@@ -0,0 +1,111 @@
+#include "PatternFeatures.h"
+
+namespace BeatCrafter
+{
+	namespace
+	{
+		constexpr int weakestLevel = 4;
+
+		// An onset is syncopated when the next stronger position on its track
+		// is silent; it scores the difference in metric level (after
+		// Longuet-Higgins & Lee). The sum is normalised to 0..1 by the
+		// largest possible score for the same number of onsets.
+		float computeSyncopation(const PatternFeatures& features, const TimeSignature& meter)
+		{
+			if (features.numOnsets == 0)
+				return 0.0f;
+
+			std::array<int, PatternFeatures::maxSteps> level;
+			std::array<int, PatternFeatures::maxSteps> nextStronger;
+			for (int i = 0; i < features.length; ++i)
+				level[(size_t)i] = PatternFeatures::getMetricLevel(i, meter);
+
+			for (int i = 0; i < features.length; ++i)
+			{
+				nextStronger[(size_t)i] = -1;
+				for (int offset = 1; offset < features.length; ++offset)
+				{
+					int j = (i + offset) % features.length;
+					if (level[(size_t)j] < level[(size_t)i])
+					{
+						nextStronger[(size_t)i] = j;
+						break;
+					}
+				}
+			}
+
+			int score = 0;
+			for (int t = 0; t < features.numTracks; ++t)
+				for (int i = 0; i < features.length; ++i)
+				{
+					int j = nextStronger[(size_t)i];
+					if (j >= 0 && features.hasOnset(t, i) && !features.hasOnset(t, j))
+						score += level[(size_t)i] - level[(size_t)j];
+				}
+
+			return (float)score / (float)(features.numOnsets * weakestLevel);
+		}
+	}
+
+	int PatternFeatures::getMetricLevel(int step, const TimeSignature& meter)
+	{
+		int stepInBar = step % meter.getStepsPerBar();
+		int stepsPerQuarter = juce::jmax(1, meter.stepsPerQuarter);
+		if (stepInBar == 0)
+			return 0;
+		if (stepInBar % stepsPerQuarter == 0)
+			return 1;
+		if ((stepInBar * 2) % stepsPerQuarter == 0)
+			return 2;
+		if ((stepInBar * 4) % stepsPerQuarter == 0)
+			return 3;
+		return weakestLevel;
+	}
+
+	PatternFeatures PatternFeatures::fromPattern(const Pattern& pattern)
+	{
+		PatternFeatures features;
+		features.numTracks = juce::jmin(pattern.getNumTracks(), maxTracks);
+		features.length = juce::jlimit(0, maxSteps, pattern.getLength());
+
+		float velocitySum = 0.0f;
+		for (int t = 0; t < features.numTracks; ++t)
+		{
+			const auto& track = pattern.getTrack(t);
+			int trackLength = juce::jmin(features.length, track.getLength());
+			int trackOnsets = 0;
+			for (int i = 0; i < trackLength; ++i)
+			{
+				auto step = track.getStep(i);
+				if (!step->isActive())
+					continue;
+
+				features.onsets[(size_t)t][(size_t)(i >> 6)] |= (uint64_t)1 << (i & 63);
+				velocitySum += step->getVelocity();
+				++trackOnsets;
+			}
+
+			features.trackDensity[(size_t)t] = features.length > 0 ? (float)trackOnsets / (float)features.length : 0.0f;
+			features.numOnsets += trackOnsets;
+		}
+
+		int numCells = features.numTracks * features.length;
+		features.density = numCells > 0 ? (float)features.numOnsets / (float)numCells : 0.0f;
+		features.syncopation = computeSyncopation(features, pattern.getTimeSignature());
+		features.meanVelocity = features.numOnsets > 0 ? velocitySum / (float)features.numOnsets : 0.0f;
+		return features;
+	}
+
+	float PatternFeatures::similarity(const PatternFeatures& a, const PatternFeatures& b)
+	{
+		int shared = 0;
+		int combined = 0;
+		for (size_t t = 0; t < (size_t)maxTracks; ++t)
+			for (size_t word = 0; word < (size_t)maskWords; ++word)
+			{
+				shared += juce::countNumberOfBits((juce::uint64)(a.onsets[t][word] & b.onsets[t][word]));
+				combined += juce::countNumberOfBits((juce::uint64)(a.onsets[t][word] | b.onsets[t][word]));
+			}
+		return combined > 0 ? (float)shared / (float)combined : 1.0f;
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Pattern.h"
+#include "PlaybackPattern.h"
+#include <array>
+#include <cstdint>
+
+namespace BeatCrafter
+{
+	// Compact summary of a pattern for ranking and similarity search:
+	// per-track onset masks and densities, plus density, syncopation and
+	// mean velocity of all onsets.
+	struct PatternFeatures
+	{
+		static constexpr int maxTracks = PlaybackPattern::maxTracks;
+		static constexpr int maxSteps = PlaybackPattern::maxSteps;
+		static constexpr int maskWords = PlaybackPattern::maskWords;
+
+		std::array<std::array<uint64_t, maskWords>, maxTracks> onsets{};
+		std::array<float, maxTracks> trackDensity{};
+		int numTracks = 0;
+		int length = 0;
+		int numOnsets = 0;
+		float density = 0.0f;
+		float syncopation = 0.0f;
+		float meanVelocity = 0.0f;
+
+		static PatternFeatures fromPattern(const Pattern& pattern);
+
+		// Jaccard index of the two onset sets: 1 when identical (or both empty), 0 when disjoint.
+		static float similarity(const PatternFeatures& a, const PatternFeatures& b);
+
+		// 0 for the downbeat, then quarter, eighth and sixteenth positions; 4 for anything finer.
+		static int getMetricLevel(int step, const TimeSignature& meter);
+
+		bool hasOnset(int track, int step) const
+		{
+			return (onsets[(size_t)track][(size_t)(step >> 6)] >> (step & 63)) & 1u;
+		}
+	};
+}
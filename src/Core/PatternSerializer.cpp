@@ -0,0 +1,122 @@
+#include "PatternSerializer.h"
+
+namespace BeatCrafter
+{
+	void PatternSerializer::write(const Pattern& pattern, juce::OutputStream& stream)
+	{
+		int length = juce::jlimit(1, maxSteps, pattern.getLength());
+		int numWords = (length + 63) / 64;
+		auto ts = pattern.getTimeSignature();
+
+		stream.writeByte((char)formatVersion);
+		stream.writeString(pattern.getName());
+		stream.writeFloat(pattern.getSwing());
+		stream.writeByte((char)ts.numerator);
+		stream.writeByte((char)ts.denominator);
+		stream.writeByte((char)ts.stepsPerQuarter);
+		stream.writeShort((short)length);
+		stream.writeByte((char)pattern.getNumTracks());
+
+		for (int trackIndex = 0; trackIndex < pattern.getNumTracks(); ++trackIndex)
+		{
+			const auto& track = pattern.getTrack(trackIndex);
+			stream.writeString(track.getName());
+			stream.writeByte((char)track.getMidiNote());
+
+			int trackLength = juce::jmin(length, track.getLength());
+			for (int word = 0; word < numWords; ++word)
+			{
+				juce::uint64 mask = 0;
+				for (int bit = 0; bit < 64; ++bit)
+				{
+					int stepIndex = word * 64 + bit;
+					if (stepIndex >= trackLength)
+						break;
+					if (track.getStep(stepIndex)->isActive())
+						mask |= (juce::uint64)1 << bit;
+				}
+				stream.writeInt64((juce::int64)mask);
+			}
+
+			for (int stepIndex = 0; stepIndex < trackLength; ++stepIndex)
+			{
+				auto step = track.getStep(stepIndex);
+				if (!step->isActive())
+					continue;
+
+				stream.writeByte((char)quantizeUnit(step->getVelocity()));
+				stream.writeByte((char)quantizeUnit(step->getProbability()));
+				stream.writeByte((char)quantizeMicroTiming(step->getMicroTiming()));
+			}
+		}
+	}
+
+	std::unique_ptr<Pattern> PatternSerializer::read(juce::InputStream& stream)
+	{
+		int version = (juce::uint8)stream.readByte();
+		if (version < 1 || version > formatVersion)
+			return nullptr;
+		return readUnversioned(stream, version);
+	}
+
+	std::unique_ptr<Pattern> PatternSerializer::readUnversioned(juce::InputStream& stream, int version)
+	{
+		auto pattern = std::make_unique<Pattern>(stream.readString());
+		pattern->setSwing(stream.readFloat());
+
+		TimeSignature ts;
+		ts.numerator = (juce::uint8)stream.readByte();
+		ts.denominator = (juce::uint8)stream.readByte();
+		if (version >= 2)
+			ts.stepsPerQuarter = (juce::uint8)stream.readByte();
+		int length = stream.readShort();
+		int numTracks = (juce::uint8)stream.readByte();
+		if (ts.numerator <= 0 || ts.denominator <= 0 || ts.stepsPerQuarter <= 0 || length <= 0 || length > maxSteps)
+			return nullptr;
+
+		pattern->setTimeSignature(ts);
+		pattern->setLength(length);
+		int numWords = (length + 63) / 64;
+
+		for (int trackIndex = 0; trackIndex < numTracks; ++trackIndex)
+		{
+			if (stream.isExhausted())
+				return nullptr;
+
+			auto name = stream.readString();
+			int midiNote = (juce::uint8)stream.readByte();
+
+			std::array<juce::uint64, (maxSteps + 63) / 64> masks{};
+			for (int word = 0; word < numWords; ++word)
+				masks[(size_t)word] = (juce::uint64)stream.readInt64();
+
+			Track* track = trackIndex < pattern->getNumTracks() ? &pattern->getTrack(trackIndex) : nullptr;
+			if (track)
+			{
+				track->setName(name);
+				track->setMidiNote(midiNote);
+				track->clear();
+			}
+
+			for (int stepIndex = 0; stepIndex < length; ++stepIndex)
+			{
+				if (((masks[(size_t)(stepIndex / 64)] >> (stepIndex % 64)) & 1u) == 0)
+					continue;
+
+				auto velocity = (juce::uint8)stream.readByte();
+				auto probability = (juce::uint8)stream.readByte();
+				auto microTiming = (juce::int8)stream.readByte();
+				if (!track)
+					continue;
+
+				auto step = track->getStep(stepIndex);
+				step.setActive(true);
+				step.setVelocity(dequantizeUnit(velocity));
+				step.setProbability(dequantizeUnit(probability));
+				step.setMicroTiming(dequantizeMicroTiming(microTiming));
+			}
+		}
+
+		return pattern;
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "Pattern.h"
+#include "PlaybackPattern.h"
+#include <memory>
+
+namespace BeatCrafter
+{
+	// Compact binary encoding of a Pattern: one bit per step for the active
+	// mask, 8-bit quantized velocity/probability/micro-timing for active steps.
+	// Each blob starts with its own format version byte.
+	class PatternSerializer
+	{
+	public:
+		static constexpr int formatVersion = 2;
+
+		static void write(const Pattern& pattern, juce::OutputStream& stream);
+		static std::unique_ptr<Pattern> read(juce::InputStream& stream);
+		// Blobs written before the version byte was added; the caller knows their format.
+		static std::unique_ptr<Pattern> readUnversioned(juce::InputStream& stream, int version);
+
+	private:
+		static constexpr int maxSteps = PlaybackPattern::maxSteps;
+
+		static juce::uint8 quantizeUnit(float value) { return (juce::uint8)juce::roundToInt(juce::jlimit(0.0f, 1.0f, value) * 255.0f); }
+		static float dequantizeUnit(juce::uint8 value) { return value / 255.0f; }
+		static juce::int8 quantizeMicroTiming(float value) { return (juce::int8)juce::roundToInt(juce::jlimit(-0.5f, 0.5f, value) * 254.0f); }
+		static float dequantizeMicroTiming(juce::int8 value) { return value / 254.0f; }
+	};
+}
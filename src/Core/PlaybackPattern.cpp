@@ -0,0 +1,56 @@
+#include "PlaybackPattern.h"
+
+namespace BeatCrafter
+{
+	PlaybackPattern& PlaybackPattern::operator=(const PlaybackPattern& other)
+	{
+		if (this == &other)
+			return *this;
+
+		activeMasks = other.activeMasks;
+		cells.assign(other.cells.begin(), other.cells.end());
+		midiNotes = other.midiNotes;
+		numTracks = other.numTracks;
+		length = other.length;
+		stepsPerQuarter = other.stepsPerQuarter;
+		stepsPerBar = other.stepsPerBar;
+		stepsPerBeat = other.stepsPerBeat;
+		swing = other.swing;
+		return *this;
+	}
+
+	void PlaybackPattern::loadFrom(const Pattern& pattern)
+	{
+		numTracks = juce::jmin(pattern.getNumTracks(), maxTracks);
+		length = juce::jlimit(1, maxSteps, pattern.getLength());
+		stepsPerQuarter = juce::jmax(1, pattern.getTimeSignature().stepsPerQuarter);
+		stepsPerBar = pattern.getTimeSignature().getStepsPerBar();
+		stepsPerBeat = juce::jmax(1, stepsPerQuarter * 4 / juce::jmax(1, pattern.getTimeSignature().denominator));
+		swing = pattern.getSwing();
+
+		auto toUnit8 = [](float value) { return (uint8_t)juce::roundToInt(juce::jlimit(0.0f, 1.0f, value) * 255.0f); };
+
+		for (auto& masks : activeMasks)
+			masks.fill(0);
+		cells.assign((size_t)(length * numTracks), Cell{});
+		for (int trackIdx = 0; trackIdx < numTracks; ++trackIdx)
+		{
+			const auto& track = pattern.getTrack(trackIdx);
+			midiNotes[(size_t)trackIdx] = track.getMidiNote();
+
+			for (int stepIdx = 0; stepIdx < length; ++stepIdx)
+			{
+				auto step = track.getStep(stepIdx);
+				if (!step)
+					break;
+
+				if (step->isActive())
+					activeMasks[(size_t)trackIdx][(size_t)(stepIdx >> 6)] |= uint64_t{ 1 } << (stepIdx & 63);
+				auto& cell = cells[(size_t)(stepIdx * numTracks + trackIdx)];
+				cell.velocity = toUnit8(step->getVelocity());
+				cell.probability = toUnit8(step->getProbability());
+				cell.microTiming = (int8_t)juce::roundToInt(juce::jlimit(-0.5f, 0.5f, step->getMicroTiming()) * microTimingScale);
+			}
+		}
+	}
+}
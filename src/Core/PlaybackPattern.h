@@ -0,0 +1,76 @@
+#pragma once
+#include "Pattern.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace BeatCrafter
+{
+	class PlaybackPattern
+	{
+	public:
+		static constexpr int maxTracks = 16;
+		static constexpr int maxSteps = 128;
+		static constexpr int maskWords = maxSteps / 64;
+
+		PlaybackPattern() = default;
+		PlaybackPattern(const PlaybackPattern& other) = default;
+		// Reuses this pattern's step storage, so copying into a reserved pattern never allocates.
+		PlaybackPattern& operator=(const PlaybackPattern& other);
+
+		void loadFrom(const Pattern& pattern);
+		// Sizes the step storage for the largest grid; for patterns written on the audio thread.
+		void reserveForMaxSize() { cells.reserve((size_t)(maxSteps * maxTracks)); }
+
+		int getNumTracks() const { return numTracks; }
+		int getLength() const { return length; }
+		int getStepsPerQuarter() const { return stepsPerQuarter; }
+		int getStepsPerBar() const { return stepsPerBar; }
+
+		// Position of a step on the 16th-note grid of its bar, or -1 when it falls between 16ths.
+		int getSixteenthInBar(int step) const
+		{
+			int scaled = (step % stepsPerBar) * 4;
+			return scaled % stepsPerQuarter == 0 ? scaled / stepsPerQuarter : -1;
+		}
+		// Beat of its bar a step starts, counted in the meter's denominator, or -1 between beats.
+		int getBeatInBar(int step) const
+		{
+			int stepInBar = step % stepsPerBar;
+			return stepInBar % stepsPerBeat == 0 ? stepInBar / stepsPerBeat : -1;
+		}
+		float getSwing() const { return swing; }
+		int getMidiNote(int track) const { return midiNotes[(size_t)track]; }
+
+		uint64_t getActiveMask(int track, int word) const { return activeMasks[(size_t)track][(size_t)word]; }
+		bool isActive(int track, int step) const { return ((activeMasks[(size_t)track][(size_t)(step >> 6)] >> (step & 63)) & 1u) != 0; }
+
+		float getVelocity(int track, int step) const { return getCell(track, step).velocity * (1.0f / 255.0f); }
+		float getProbability(int track, int step) const { return getCell(track, step).probability * (1.0f / 255.0f); }
+		float getMicroTiming(int track, int step) const { return getCell(track, step).microTiming * (1.0f / microTimingScale); }
+
+	private:
+		// Step micro-timing is clamped to half a step, so it fits a signed byte.
+		static constexpr float microTimingScale = 254.0f;
+
+		struct Cell
+		{
+			uint8_t velocity = 0;
+			uint8_t probability = 0;
+			int8_t microTiming = 0;
+		};
+
+		const Cell& getCell(int track, int step) const { return cells[(size_t)(step * numTracks + track)]; }
+
+		std::array<std::array<uint64_t, maskWords>, maxTracks> activeMasks{};
+		// Step-major, numTracks cells per step; only the loaded length is stored.
+		std::vector<Cell> cells;
+		std::array<int, maxTracks> midiNotes{};
+		int numTracks = 0;
+		int length = 16;
+		int stepsPerQuarter = 4;
+		int stepsPerBar = 16;
+		int stepsPerBeat = 4;
+		float swing = 0.0f;
+	};
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+
+namespace BeatCrafter
+{
+	class RandomState
+	{
+	public:
+		explicit RandomState(uint64_t seed = 0) { setSeed(seed); }
+
+		void setSeed(uint64_t seed)
+		{
+			uint64_t z = seed + 0x9e3779b97f4a7c15ull;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			state = z ^ (z >> 31);
+			if (state == 0)
+				state = 0x9e3779b97f4a7c15ull;
+		}
+
+		uint32_t nextUInt()
+		{
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return static_cast<uint32_t>((state * 0x2545f4914f6cdd1dull) >> 32);
+		}
+
+		float nextFloat() { return static_cast<float>(nextUInt() >> 8) * (1.0f / 16777216.0f); }
+		float nextFloat(float min, float max) { return min + (max - min) * nextFloat(); }
+		bool nextChance(float probability) { return nextFloat() < probability; }
+		int nextInt(int maxExclusive) { return static_cast<int>((static_cast<uint64_t>(nextUInt()) * static_cast<uint64_t>(maxExclusive)) >> 32); }
+
+	private:
+		uint64_t state = 0;
+	};
+}
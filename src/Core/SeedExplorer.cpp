@@ -0,0 +1,128 @@
+#include "SeedExplorer.h"
+#include "FeatureIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace BeatCrafter
+{
+	namespace
+	{
+		// Started on the first explore() and kept for the process; the calling
+		// thread always works too, so the pool holds one thread fewer than cores.
+		juce::ThreadPool& getWorkerPool()
+		{
+			static juce::ThreadPool pool(juce::jmax(1, juce::SystemStats::getNumCpus() - 1));
+			return pool;
+		}
+	}
+
+	size_t SeedExplorer::getNumVariations(const Grid& grid)
+	{
+		return grid.styles.size() * grid.seeds.size() * grid.intensities.size();
+	}
+
+	Pattern SeedExplorer::generateBase(const Grid& grid, int style, uint32_t seed)
+	{
+		Pattern base("Explore");
+		base.setTimeSignature(grid.meter);
+		base.setNumBars(grid.numBars);
+		const auto& definition = grid.styles[(size_t)style];
+		StyleManager::generateBasicPattern(base, definition, seed);
+		StyleManager::applyComplexityToPattern(base, definition, juce::jmax(0.1f, grid.complexity), seed);
+		return base;
+	}
+
+	Pattern SeedExplorer::generate(const Grid& grid, const Variation& variation)
+	{
+		return StyleManager::applyIntensity(generateBase(grid, variation.style, variation.seed),
+			variation.intensity, grid.styles[(size_t)variation.style], variation.seed);
+	}
+
+	bool SeedExplorer::explore(const Grid& grid, Variation* results, int numThreads,
+		const std::atomic<bool>* shouldCancel)
+	{
+		// One work unit per (style, seed): the base pattern is shared by all intensities.
+		size_t numSeeds = grid.seeds.size();
+		size_t numIntensities = grid.intensities.size();
+		size_t numUnits = grid.styles.size() * numSeeds;
+		if (numUnits == 0 || numIntensities == 0)
+			return true;
+
+		std::atomic<size_t> nextUnit{ 0 };
+		auto worker = [&]()
+			{
+				while (shouldCancel == nullptr || !shouldCancel->load(std::memory_order_relaxed))
+				{
+					size_t unit = nextUnit++;
+					if (unit >= numUnits)
+						break;
+
+					int style = (int)(unit / numSeeds);
+					uint32_t seed = grid.seeds[unit % numSeeds];
+					auto base = generateBase(grid, style, seed);
+
+					for (size_t i = 0; i < numIntensities; ++i)
+					{
+						auto& result = results[unit * numIntensities + i];
+						result.style = style;
+						result.seed = seed;
+						result.intensity = grid.intensities[i];
+						result.features = PatternFeatures::fromPattern(
+							StyleManager::applyIntensity(base, result.intensity, grid.styles[(size_t)style], seed));
+					}
+				}
+			};
+
+		auto& pool = getWorkerPool();
+		if (numThreads <= 0)
+			numThreads = juce::SystemStats::getNumCpus();
+		numThreads = (int)juce::jmin((size_t)juce::jmax(1, numThreads), (size_t)pool.getNumThreads() + 1, numUnits);
+
+		std::atomic<int> pendingJobs{ numThreads - 1 };
+		juce::WaitableEvent jobsFinished;
+		for (int i = 1; i < numThreads; ++i)
+			pool.addJob([&]()
+				{
+					worker();
+					if (--pendingJobs == 0)
+						jobsFinished.signal();
+				});
+		worker();
+		if (numThreads > 1)
+			jobsFinished.wait();
+
+		return nextUnit.load() >= numUnits;
+	}
+
+	std::vector<size_t> SeedExplorer::rankByDensity(const Variation* results, size_t count, float targetDensity)
+	{
+		std::vector<size_t> order(count);
+		std::iota(order.begin(), order.end(), (size_t)0);
+		std::stable_sort(order.begin(), order.end(),
+			[&](size_t a, size_t b)
+			{
+				return std::abs(results[a].features.density - targetDensity)
+					< std::abs(results[b].features.density - targetDensity);
+			});
+		return order;
+	}
+
+	std::vector<size_t> SeedExplorer::rankBySimilarity(const Variation* results, size_t count, const PatternFeatures& reference)
+	{
+		FeatureIndex index;
+		index.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+			index.add(results[i].features);
+
+		FeatureIndex::Query query(reference);
+		query.densityWeight = query.syncopationWeight = query.velocityWeight = 0.0f;
+
+		std::vector<size_t> order;
+		order.reserve(count);
+		for (const auto& match : index.findNearest(query, (int)juce::jmin(count, (size_t)std::numeric_limits<int>::max())))
+			order.push_back(match.index);
+		return order;
+	}
+}
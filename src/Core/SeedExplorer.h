@@ -0,0 +1,56 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "PatternFeatures.h"
+#include "StyleManager.h"
+#include <atomic>
+#include <vector>
+
+namespace BeatCrafter
+{
+	// Batch generation of candidate patterns for every (style, seed, intensity)
+	// in a grid, spread over a shared pool of worker threads. Only the
+	// PatternFeatures of each candidate are kept; the pattern itself is
+	// reproducible from its coordinates with generate().
+	class SeedExplorer
+	{
+	public:
+		struct Grid
+		{
+			std::vector<StyleTable::StyleDefinition> styles;
+			std::vector<uint32_t> seeds;
+			std::vector<float> intensities;
+			TimeSignature meter;
+			int numBars = 1;
+			float complexity = 0.5f;
+		};
+
+		struct Variation
+		{
+			int style = 0;
+			uint32_t seed = 0;
+			float intensity = 0.0f;
+			PatternFeatures features;
+		};
+
+		static size_t getNumVariations(const Grid& grid);
+
+		// Results are laid out [style][seed][intensity]; the buffer must hold
+		// getNumVariations(grid) entries. numThreads <= 0 uses every core.
+		// Setting shouldCancel stops the workers after their current (style,
+		// seed); explore then returns false and leaves the remaining results
+		// untouched.
+		static bool explore(const Grid& grid, Variation* results, int numThreads = 0,
+			const std::atomic<bool>* shouldCancel = nullptr);
+
+		static Pattern generateBase(const Grid& grid, int style, uint32_t seed);
+		static Pattern generate(const Grid& grid, const Variation& variation);
+
+		// Indices of results ordered by closeness of their density to target.
+		static std::vector<size_t> rankByDensity(const Variation* results, size_t count, float targetDensity);
+
+		// Indices of results ordered by the Hamming distance of their onsets to
+		// the reference's, ties by index. FeatureIndex::Query adds density,
+		// syncopation and per-track filters on top of this.
+		static std::vector<size_t> rankBySimilarity(const Variation* results, size_t count, const PatternFeatures& reference);
+	};
+}
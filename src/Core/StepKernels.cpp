@@ -0,0 +1,239 @@
+#include "StepKernels.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#if JUCE_USE_SSE_INTRINSICS
+#include <emmintrin.h>
+#elif JUCE_USE_ARM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace BeatCrafter
+{
+	namespace StepKernels
+	{
+		namespace Scalar
+		{
+			void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+							 float velocityGain, float probabilityGain)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					if (active[i] == 0)
+						continue;
+					velocity[i] = juce::jlimit(0.0f, 1.0f, velocity[i] * velocityGain);
+					if (probability[i] < 1.0f)
+						probability[i] = juce::jlimit(0.0f, 1.0f, probability[i] * probabilityGain);
+				}
+			}
+
+			void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+						  const float* omitDraws, const float* omitChances, int count, float minVelocity)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					if (active[i] == 0)
+						continue;
+					velocity[i] = juce::jlimit(0.0f, 1.0f, juce::jlimit(minVelocity, 1.0f, velocity[i] + velocityOffsets[i]));
+					if (omitDraws[i] < omitChances[i])
+						active[i] = 0;
+				}
+			}
+
+			void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+						   const float* hitVelocity, const float* hitProbability, int count)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					if (hits[i] == 0)
+						continue;
+					active[i] = 1;
+					velocity[i] = juce::jlimit(0.0f, 1.0f, hitVelocity[i]);
+					probability[i] = juce::jlimit(0.0f, 1.0f, hitProbability[i]);
+				}
+			}
+		}
+
+#if JUCE_USE_SSE_INTRINSICS
+		namespace
+		{
+			inline __m128 isSet(const uint32_t* flags)
+			{
+				auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags));
+				auto isZero = _mm_cmpeq_epi32(value, _mm_setzero_si128());
+				return _mm_castsi128_ps(_mm_xor_si128(isZero, _mm_set1_epi32(-1)));
+			}
+
+			inline __m128 select(__m128 mask, __m128 ifSet, __m128 otherwise)
+			{
+				return _mm_or_ps(_mm_and_ps(mask, ifSet), _mm_andnot_ps(mask, otherwise));
+			}
+
+			inline __m128 clamp(__m128 value, __m128 low, __m128 high)
+			{
+				return _mm_min_ps(_mm_max_ps(value, low), high);
+			}
+		}
+
+		void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+						 float velocityGain, float probabilityGain)
+		{
+			const auto zero = _mm_setzero_ps();
+			const auto one = _mm_set1_ps(1.0f);
+			const auto vGain = _mm_set1_ps(velocityGain);
+			const auto pGain = _mm_set1_ps(probabilityGain);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(active + i);
+				auto v = _mm_loadu_ps(velocity + i);
+				auto p = _mm_loadu_ps(probability + i);
+				auto scaleProbability = _mm_and_ps(mask, _mm_cmplt_ps(p, one));
+
+				_mm_storeu_ps(velocity + i, select(mask, clamp(_mm_mul_ps(v, vGain), zero, one), v));
+				_mm_storeu_ps(probability + i, select(scaleProbability, clamp(_mm_mul_ps(p, pGain), zero, one), p));
+			}
+			Scalar::scaleActive(active + i, velocity + i, probability + i, count - i, velocityGain, probabilityGain);
+		}
+
+		void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+					  const float* omitDraws, const float* omitChances, int count, float minVelocity)
+		{
+			const auto zero = _mm_setzero_ps();
+			const auto one = _mm_set1_ps(1.0f);
+			const auto minimum = _mm_set1_ps(minVelocity);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(active + i);
+				auto v = _mm_loadu_ps(velocity + i);
+				auto jittered = clamp(clamp(_mm_add_ps(v, _mm_loadu_ps(velocityOffsets + i)), minimum, one), zero, one);
+				auto omit = _mm_and_ps(mask, _mm_cmplt_ps(_mm_loadu_ps(omitDraws + i), _mm_loadu_ps(omitChances + i)));
+
+				_mm_storeu_ps(velocity + i, select(mask, jittered, v));
+				auto flags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(active + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(active + i), _mm_andnot_si128(_mm_castps_si128(omit), flags));
+			}
+			Scalar::humanize(active + i, velocity + i, velocityOffsets + i, omitDraws + i, omitChances + i, count - i, minVelocity);
+		}
+
+		void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+					   const float* hitVelocity, const float* hitProbability, int count)
+		{
+			const auto zero = _mm_setzero_ps();
+			const auto one = _mm_set1_ps(1.0f);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(hits + i);
+				auto flags = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(active + i)));
+				auto merged = select(mask, _mm_castsi128_ps(_mm_set1_epi32(1)), flags);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(active + i), _mm_castps_si128(merged));
+				_mm_storeu_ps(velocity + i, select(mask, clamp(_mm_loadu_ps(hitVelocity + i), zero, one), _mm_loadu_ps(velocity + i)));
+				_mm_storeu_ps(probability + i, select(mask, clamp(_mm_loadu_ps(hitProbability + i), zero, one), _mm_loadu_ps(probability + i)));
+			}
+			Scalar::mergeHits(active + i, velocity + i, probability + i, hits + i, hitVelocity + i, hitProbability + i, count - i);
+		}
+
+		const char* getInstructionSet() { return "sse2"; }
+
+#elif JUCE_USE_ARM_NEON
+		namespace
+		{
+			inline uint32x4_t isSet(const uint32_t* flags)
+			{
+				return vmvnq_u32(vceqq_u32(vld1q_u32(flags), vdupq_n_u32(0)));
+			}
+
+			inline float32x4_t clamp(float32x4_t value, float32x4_t low, float32x4_t high)
+			{
+				return vminq_f32(vmaxq_f32(value, low), high);
+			}
+		}
+
+		void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+						 float velocityGain, float probabilityGain)
+		{
+			const auto zero = vdupq_n_f32(0.0f);
+			const auto one = vdupq_n_f32(1.0f);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(active + i);
+				auto v = vld1q_f32(velocity + i);
+				auto p = vld1q_f32(probability + i);
+				auto scaleProbability = vandq_u32(mask, vcltq_f32(p, one));
+
+				vst1q_f32(velocity + i, vbslq_f32(mask, clamp(vmulq_n_f32(v, velocityGain), zero, one), v));
+				vst1q_f32(probability + i, vbslq_f32(scaleProbability, clamp(vmulq_n_f32(p, probabilityGain), zero, one), p));
+			}
+			Scalar::scaleActive(active + i, velocity + i, probability + i, count - i, velocityGain, probabilityGain);
+		}
+
+		void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+					  const float* omitDraws, const float* omitChances, int count, float minVelocity)
+		{
+			const auto zero = vdupq_n_f32(0.0f);
+			const auto one = vdupq_n_f32(1.0f);
+			const auto minimum = vdupq_n_f32(minVelocity);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(active + i);
+				auto v = vld1q_f32(velocity + i);
+				auto jittered = clamp(clamp(vaddq_f32(v, vld1q_f32(velocityOffsets + i)), minimum, one), zero, one);
+				auto omit = vandq_u32(mask, vcltq_f32(vld1q_f32(omitDraws + i), vld1q_f32(omitChances + i)));
+
+				vst1q_f32(velocity + i, vbslq_f32(mask, jittered, v));
+				vst1q_u32(active + i, vbicq_u32(vld1q_u32(active + i), omit));
+			}
+			Scalar::humanize(active + i, velocity + i, velocityOffsets + i, omitDraws + i, omitChances + i, count - i, minVelocity);
+		}
+
+		void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+					   const float* hitVelocity, const float* hitProbability, int count)
+		{
+			const auto zero = vdupq_n_f32(0.0f);
+			const auto one = vdupq_n_f32(1.0f);
+
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				auto mask = isSet(hits + i);
+				vst1q_u32(active + i, vbslq_u32(mask, vdupq_n_u32(1), vld1q_u32(active + i)));
+				vst1q_f32(velocity + i, vbslq_f32(mask, clamp(vld1q_f32(hitVelocity + i), zero, one), vld1q_f32(velocity + i)));
+				vst1q_f32(probability + i, vbslq_f32(mask, clamp(vld1q_f32(hitProbability + i), zero, one), vld1q_f32(probability + i)));
+			}
+			Scalar::mergeHits(active + i, velocity + i, probability + i, hits + i, hitVelocity + i, hitProbability + i, count - i);
+		}
+
+		const char* getInstructionSet() { return "neon"; }
+
+#else
+		void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+						 float velocityGain, float probabilityGain)
+		{
+			Scalar::scaleActive(active, velocity, probability, count, velocityGain, probabilityGain);
+		}
+
+		void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+					  const float* omitDraws, const float* omitChances, int count, float minVelocity)
+		{
+			Scalar::humanize(active, velocity, velocityOffsets, omitDraws, omitChances, count, minVelocity);
+		}
+
+		void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+					   const float* hitVelocity, const float* hitProbability, int count)
+		{
+			Scalar::mergeHits(active, velocity, probability, hits, hitVelocity, hitProbability, count);
+		}
+
+		const char* getInstructionSet() { return "scalar"; }
+#endif
+	}
+}
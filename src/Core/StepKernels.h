@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+
+namespace BeatCrafter
+{
+	// Per-step transforms over structure-of-arrays lanes: one active flag
+	// (0 or non-zero), velocity and probability value per step. Every kernel
+	// has a scalar reference in StepKernels::Scalar that mirrors Step's
+	// clamping setters; the default entry points run 4 lanes at a time with
+	// SSE2 or NEON when JUCE enables them, and must match the reference bit
+	// for bit (beatcrafter_tests checks this).
+	//
+	// Random draws are made by the caller, in the same order as the original
+	// per-step loops, so seeds keep producing the same patterns.
+	namespace StepKernels
+	{
+		// active: velocity *= velocityGain; probability *= probabilityGain when below 1. Both clamped to [0, 1].
+		void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+						 float velocityGain, float probabilityGain);
+
+		// active: velocity = clamp(velocity + velocityOffset, minVelocity, 1), then cleared when omitDraw < omitChance.
+		void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+					  const float* omitDraws, const float* omitChances, int count, float minVelocity);
+
+		// hit: active set, velocity and probability replaced by the clamped hit values.
+		void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+					   const float* hitVelocity, const float* hitProbability, int count);
+
+		const char* getInstructionSet();
+
+		namespace Scalar
+		{
+			void scaleActive(const uint32_t* active, float* velocity, float* probability, int count,
+							 float velocityGain, float probabilityGain);
+			void humanize(uint32_t* active, float* velocity, const float* velocityOffsets,
+						  const float* omitDraws, const float* omitChances, int count, float minVelocity);
+			void mergeHits(uint32_t* active, float* velocity, float* probability, const uint32_t* hits,
+						   const float* hitVelocity, const float* hitProbability, int count);
+		}
+	}
+}
@@ -0,0 +1,423 @@
+#include "StyleDocument.h"
+#include <iterator>
+
+namespace BeatCrafter
+{
+	namespace
+	{
+		using namespace StyleTable;
+
+		constexpr const char* familyNames[] = {
+			"Rock", "Metal", "Jazz", "Funk", "Electronic", "HipHop", "Latin", "Punk"
+		};
+
+		constexpr const char* trackNames[] = {
+			"Kick", "Snare", "HiHat", "OpenHiHat", "Crash", "Ride",
+			"TomHigh", "TomLow", "RideBell", "HiHatPedal", "Splash", "China"
+		};
+		static_assert(std::size(trackNames) == numTracks, "one name per StyleTable::Track");
+
+		constexpr const char* ruleKindNames[] = { "none", "each", "firstMatch", "ghostNotes" };
+		constexpr const char* ruleGateNames[] = { "always", "chance", "otherwise" };
+
+		// Keeps the first error, prefixed with the path of the value that caused it.
+		struct Reader
+		{
+			juce::String error;
+
+			bool fail(const juce::String& path, const juce::String& message)
+			{
+				if (error.isEmpty())
+					error = path + ": " + message;
+				return false;
+			}
+
+			bool readNumber(const juce::var& value, const juce::String& path, float& result)
+			{
+				if (!value.isDouble() && !value.isInt() && !value.isInt64())
+					return fail(path, "expected a number");
+				result = (float)(double)value;
+				return true;
+			}
+
+			template <size_t N>
+			bool readName(const juce::var& value, const juce::String& path, const char* const (&names)[N], int& index)
+			{
+				if (value.isString())
+				{
+					for (size_t i = 0; i < N; ++i)
+					{
+						if (value.toString().equalsIgnoreCase(names[i]))
+						{
+							index = (int)i;
+							return true;
+						}
+					}
+				}
+
+				juce::StringArray choices(names, (int)N);
+				return fail(path, "expected one of " + choices.joinIntoString(", "));
+			}
+
+			bool readTrack(const juce::var& value, const juce::String& path, uint8_t& track)
+			{
+				int index = 0;
+				if (!readName(value, path, trackNames, index))
+					return false;
+				track = (uint8_t)index;
+				return true;
+			}
+
+			// Optional: a plain number is the base probability.
+			bool readChance(const juce::var& value, const juce::String& path, Chance& chance)
+			{
+				if (value.isVoid())
+					return true;
+				if (!value.isObject())
+					return readNumber(value, path, chance.base);
+
+				return (!value.hasProperty("base") || readNumber(value["base"], path + ".base", chance.base))
+					&& (!value.hasProperty("perIntensity")
+						|| readNumber(value["perIntensity"], path + ".perIntensity", chance.perIntensity));
+			}
+
+			bool readVelocity(const juce::var& value, const juce::String& path, Velocity& velocity)
+			{
+				if (!value.isObject())
+				{
+					velocity.mode = VelocityMode::Fixed;
+					if (!readNumber(value, path, velocity.min))
+						return false;
+					velocity.max = velocity.min;
+					return true;
+				}
+
+				if (value.hasProperty("random"))
+				{
+					const auto* range = value["random"].getArray();
+					if (range == nullptr || range->size() != 2)
+						return fail(path + ".random", "expected [ min, max ]");
+					velocity.mode = VelocityMode::Random;
+					return readNumber(range->getReference(0), path + ".random[0]", velocity.min)
+						&& readNumber(range->getReference(1), path + ".random[1]", velocity.max);
+				}
+
+				velocity.mode = VelocityMode::RandomPercent;
+				return readNumber(value["base"], path + ".base", velocity.min)
+					&& readNumber(value["percent"], path + ".percent", velocity.max);
+			}
+
+			bool readSteps(const juce::var& value, const juce::String& path, StepMask& mask)
+			{
+				const auto* list = value.getArray();
+				if (list == nullptr || list->isEmpty())
+					return fail(path, "expected a list of steps");
+
+				mask = 0;
+				for (int i = 0; i < list->size(); ++i)
+				{
+					const auto& step = list->getReference(i);
+					if (!step.isInt() && !step.isInt64())
+						return fail(path + "[" + juce::String(i) + "]", "expected a step index");
+					int index = (int)step;
+					if (index < 0 || index >= templateSteps)
+						return fail(path + "[" + juce::String(i) + "]",
+							"steps run from 0 to " + juce::String(templateSteps - 1));
+					mask = (StepMask)(mask | (1u << index));
+				}
+				return true;
+			}
+
+			bool readHit(const juce::var& value, const juce::String& path, Hit& h)
+			{
+				if (!value.isObject())
+					return fail(path, "expected a hit object");
+
+				return readTrack(value["track"], path + ".track", h.track)
+					&& readSteps(value["steps"], path + ".steps", h.steps)
+					&& readVelocity(value["velocity"], path + ".velocity", h.velocity)
+					&& (!value.hasProperty("probability") || readNumber(value["probability"], path + ".probability", h.probability))
+					&& readChance(value["chance"], path + ".chance", h.chance);
+			}
+
+			bool readRule(const juce::var& value, const juce::String& path, Rule& rule)
+			{
+				if (!value.isObject())
+					return fail(path, "expected a rule object");
+
+				int kind = 0;
+				int gate = 0;
+				if (!readName(value["kind"], path + ".kind", ruleKindNames, kind)
+					|| (value.hasProperty("gate") && !readName(value["gate"], path + ".gate", ruleGateNames, gate))
+					|| !readChance(value["gateChance"], path + ".gateChance", rule.gateChance)
+					|| !readChance(value["stepChance"], path + ".stepChance", rule.stepChance))
+					return false;
+
+				rule.kind = (RuleKind)kind;
+				rule.gate = (RuleGate)gate;
+				if (rule.kind == RuleKind::None)
+					return fail(path + ".kind", "a rule needs a kind");
+				if (rule.kind == RuleKind::GhostNotes)
+					return readTrack(value["track"], path + ".track", rule.hits[0].track);
+
+				const auto* hits = value["hits"].getArray();
+				if (hits == nullptr || hits->isEmpty() || hits->size() > maxHitsPerRule)
+					return fail(path + ".hits", "expected 1 to " + juce::String(maxHitsPerRule) + " hits");
+
+				for (int i = 0; i < hits->size(); ++i)
+					if (!readHit(hits->getReference(i), path + ".hits[" + juce::String(i) + "]", rule.hits[(size_t)i]))
+						return false;
+				return true;
+			}
+
+			// Optional: a missing section has no rules.
+			bool readSection(const juce::var& value, const juce::String& path, Section& section)
+			{
+				if (value.isVoid())
+					return true;
+
+				const auto* rules = value.getArray();
+				if (rules == nullptr || rules->size() > maxRulesPerSection)
+					return fail(path, "expected up to " + juce::String(maxRulesPerSection) + " rules");
+
+				for (int i = 0; i < rules->size(); ++i)
+					if (!readRule(rules->getReference(i), path + "[" + juce::String(i) + "]", section.rules[(size_t)i]))
+						return false;
+				return true;
+			}
+
+			bool readBandedSection(const juce::var& value, const juce::String& path, BandedSection& banded)
+			{
+				if (!value.isObject())
+					return fail(path, "expected { \"clearTracks\": [...], \"bands\": [...] }");
+
+				if (value.hasProperty("clearTracks"))
+				{
+					const auto* list = value["clearTracks"].getArray();
+					if (list == nullptr)
+						return fail(path + ".clearTracks", "expected a list of tracks");
+					for (int i = 0; i < list->size(); ++i)
+					{
+						uint8_t track = 0;
+						if (!readTrack(list->getReference(i), path + ".clearTracks[" + juce::String(i) + "]", track))
+							return false;
+						banded.clearTracks = (TrackMask)(banded.clearTracks | (1u << track));
+					}
+				}
+
+				const auto* bands = value["bands"].getArray();
+				if (bands == nullptr || bands->isEmpty() || bands->size() > maxBands)
+					return fail(path + ".bands", "expected 1 to " + juce::String(maxBands) + " bands");
+
+				banded.numBands = bands->size();
+				for (int i = 0; i < bands->size(); ++i)
+				{
+					const auto& band = bands->getReference(i);
+					auto bandPath = path + ".bands[" + juce::String(i) + "]";
+					auto& target = banded.bands[(size_t)i];
+					if (!band.isObject())
+						return fail(bandPath, "expected a band object");
+					if ((band.hasProperty("maxIntensity") && !readNumber(band["maxIntensity"], bandPath + ".maxIntensity", target.maxIntensity))
+						|| !readSection(band["rules"], bandPath + ".rules", target.section))
+						return false;
+				}
+				return true;
+			}
+
+			bool readStyle(const juce::var& value, const juce::String& path, StylePack::Entry& entry)
+			{
+				if (!value.isObject())
+					return fail(path, "expected a style object");
+				if (!value["name"].isString() || value["name"].toString().trim().isEmpty())
+					return fail(path + ".name", "a style needs a name");
+
+				entry.name = value["name"].toString().trim();
+				auto stylePath = "\"" + entry.name + "\"";
+				auto& style = entry.definition;
+
+				int family = 0;
+				if (!readName(value["family"], stylePath + ".family", familyNames, family)
+					|| (value.hasProperty("swing") && !readNumber(value["swing"], stylePath + ".swing", style.swing))
+					|| !readSection(value["pattern"], stylePath + ".pattern", style.pattern)
+					|| !readBandedSection(value["snare"], stylePath + ".snare", style.snare)
+					|| !readBandedSection(value["hiHat"], stylePath + ".hiHat", style.hiHat)
+					|| !readSection(value["breakFill"], stylePath + ".breakFill", style.breakFill))
+					return false;
+				style.family = (StyleType)family;
+
+				const juce::String invalidRules = "a rule has an inverted random velocity, a percent outside 0-100 or no steps";
+				const juce::String invalidBands = "band maxIntensity values must rise";
+				if (!isValid(style.pattern))
+					return fail(stylePath + ".pattern", invalidRules);
+				if (!isValid(style.snare))
+					return fail(stylePath + ".snare", isValid(style.snare.bands[0].section) ? invalidBands : invalidRules);
+				if (!isValid(style.hiHat))
+					return fail(stylePath + ".hiHat", isValid(style.hiHat.bands[0].section) ? invalidBands : invalidRules);
+				if (!isValid(style.breakFill))
+					return fail(stylePath + ".breakFill", invalidRules);
+				if (!isValid(style))
+					return fail(stylePath + ".swing", "swing must be between 0 and 1");
+				return true;
+			}
+		};
+
+		juce::var toVar(const Chance& c)
+		{
+			if (c.perIntensity == 0.0f)
+				return c.base;
+
+			auto* object = new juce::DynamicObject();
+			object->setProperty("base", c.base);
+			object->setProperty("perIntensity", c.perIntensity);
+			return juce::var(object);
+		}
+
+		juce::var toVar(const Velocity& velocity)
+		{
+			if (velocity.mode == VelocityMode::Fixed)
+				return velocity.min;
+
+			auto* object = new juce::DynamicObject();
+			if (velocity.mode == VelocityMode::Random)
+				object->setProperty("random", juce::Array<juce::var>{ velocity.min, velocity.max });
+			else
+			{
+				object->setProperty("base", velocity.min);
+				object->setProperty("percent", juce::roundToInt(velocity.max));
+			}
+			return juce::var(object);
+		}
+
+		juce::var toVar(const Rule& rule)
+		{
+			auto* object = new juce::DynamicObject();
+			object->setProperty("kind", ruleKindNames[(size_t)rule.kind]);
+			if (rule.gate != RuleGate::Always)
+				object->setProperty("gate", ruleGateNames[(size_t)rule.gate]);
+			if (rule.gateChance.isSet())
+				object->setProperty("gateChance", toVar(rule.gateChance));
+			if (rule.stepChance.isSet())
+				object->setProperty("stepChance", toVar(rule.stepChance));
+
+			if (rule.kind == RuleKind::GhostNotes)
+			{
+				object->setProperty("track", trackNames[rule.hits[0].track]);
+				return juce::var(object);
+			}
+
+			juce::Array<juce::var> hits;
+			for (const auto& h : rule.hits)
+			{
+				if (h.track == 0 && h.steps == 0)
+					continue;
+
+				juce::Array<juce::var> steps;
+				for (int step = 0; step < templateSteps; ++step)
+					if ((h.steps >> step) & 1u)
+						steps.add(step);
+
+				auto* hit = new juce::DynamicObject();
+				hit->setProperty("track", trackNames[h.track]);
+				hit->setProperty("steps", steps);
+				hit->setProperty("velocity", toVar(h.velocity));
+				if (h.probability != keepProbability)
+					hit->setProperty("probability", h.probability);
+				if (h.chance.isSet())
+					hit->setProperty("chance", toVar(h.chance));
+				hits.add(juce::var(hit));
+			}
+			object->setProperty("hits", hits);
+			return juce::var(object);
+		}
+
+		juce::var toVar(const Section& section)
+		{
+			juce::Array<juce::var> rules;
+			for (const auto& rule : section.rules)
+				if (rule.kind != RuleKind::None)
+					rules.add(toVar(rule));
+			return rules;
+		}
+
+		juce::var toVar(const BandedSection& banded)
+		{
+			juce::Array<juce::var> clearTracks;
+			for (int track = 0; track < numTracks; ++track)
+				if ((banded.clearTracks >> track) & 1u)
+					clearTracks.add(trackNames[track]);
+
+			juce::Array<juce::var> bands;
+			for (int b = 0; b < banded.numBands; ++b)
+			{
+				auto* band = new juce::DynamicObject();
+				band->setProperty("maxIntensity", banded.bands[(size_t)b].maxIntensity);
+				band->setProperty("rules", toVar(banded.bands[(size_t)b].section));
+				bands.add(juce::var(band));
+			}
+
+			auto* object = new juce::DynamicObject();
+			object->setProperty("clearTracks", clearTracks);
+			object->setProperty("bands", bands);
+			return juce::var(object);
+		}
+	}
+
+	juce::Result StyleDocument::parse(const juce::String& json, std::vector<StylePack::Entry>& styles)
+	{
+		juce::var root;
+		auto parsed = juce::JSON::parse(json, root);
+		if (parsed.failed())
+			return juce::Result::fail("invalid JSON: " + parsed.getErrorMessage());
+		if (!root.isObject())
+			return juce::Result::fail("expected { \"version\": 1, \"styles\": [...] }");
+		if (root.hasProperty("version") && (int)root["version"] != formatVersion)
+			return juce::Result::fail("unsupported version " + root["version"].toString());
+
+		const auto* list = root["styles"].getArray();
+		if (list == nullptr)
+			return juce::Result::fail("styles: expected a list of styles");
+
+		Reader reader;
+		std::vector<StylePack::Entry> entries;
+		for (int i = 0; i < list->size(); ++i)
+		{
+			StylePack::Entry entry;
+			if (!reader.readStyle(list->getReference(i), "styles[" + juce::String(i) + "]", entry))
+				return juce::Result::fail(reader.error);
+
+			for (const auto* existing : { &styles, &entries })
+				for (const auto& other : *existing)
+					if (other.name.equalsIgnoreCase(entry.name))
+						return juce::Result::fail("\"" + entry.name + "\": duplicate style name");
+			entries.push_back(entry);
+		}
+
+		styles.insert(styles.end(), entries.begin(), entries.end());
+		return juce::Result::ok();
+	}
+
+	juce::String StyleDocument::toJson(const std::vector<StylePack::Entry>& styles)
+	{
+		juce::Array<juce::var> list;
+		for (const auto& entry : styles)
+		{
+			const auto& style = entry.definition;
+			auto* object = new juce::DynamicObject();
+			object->setProperty("name", entry.name);
+			object->setProperty("family", familyNames[(size_t)style.family]);
+			if (style.swing != keepSwing)
+				object->setProperty("swing", style.swing);
+			object->setProperty("pattern", toVar(style.pattern));
+			object->setProperty("snare", toVar(style.snare));
+			object->setProperty("hiHat", toVar(style.hiHat));
+			object->setProperty("breakFill", toVar(style.breakFill));
+			list.add(juce::var(object));
+		}
+
+		auto* root = new juce::DynamicObject();
+		root->setProperty("version", formatVersion);
+		root->setProperty("styles", list);
+		// Tables are authored with a few decimals; six keep every float exact on the way back.
+		return juce::JSON::toString(juce::var(root), false, 6);
+	}
+}
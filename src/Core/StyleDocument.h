@@ -0,0 +1,35 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "StylePack.h"
+#include <vector>
+
+namespace BeatCrafter
+{
+	// JSON authoring format for style packs, compiled to .bcstyles by beatcrafter_stylepack.
+	//
+	//   { "version": 1, "styles": [ {
+	//       "name": "Half-time Rock", "family": "Rock", "swing": 0.1,
+	//       "pattern":   [ Rule, ... ],
+	//       "snare":     { "clearTracks": [ "Snare" ], "bands": [ { "maxIntensity": 0.4, "rules": [ Rule, ... ] } ] },
+	//       "hiHat":     { "clearTracks": [ ... ], "bands": [ ... ] },
+	//       "breakFill": [ Rule, ... ] } ] }
+	//
+	//   Rule:     { "kind": "each" | "firstMatch", "gate": "always" | "chance" | "otherwise",
+	//               "gateChance": Chance, "stepChance": Chance, "hits": [ Hit, ... ] }
+	//             { "kind": "ghostNotes", "track": "Snare", "stepChance": Chance }
+	//   Hit:      { "track": "Kick", "steps": [ 0, 8 ], "velocity": Velocity, "probability": 0.9, "chance": Chance }
+	//   Velocity: 0.9 | { "random": [ 0.7, 0.9 ] } | { "base": 0.6, "percent": 20 }
+	//   Chance:   0.3 | { "base": 0.1, "perIntensity": 0.4 }
+	//
+	// Track names follow StyleTable::Track and steps index the 16-step template bar.
+	// Only name, family, snare and hiHat are required. Parsed styles are checked
+	// with StyleTable::isValid, so a document that parses always compiles.
+	class StyleDocument
+	{
+	public:
+		static constexpr int formatVersion = 1;
+
+		static juce::Result parse(const juce::String& json, std::vector<StylePack::Entry>& styles);
+		static juce::String toJson(const std::vector<StylePack::Entry>& styles);
+	};
+}
@@ -0,0 +1,68 @@
+#include "StyleLibrary.h"
+
+namespace BeatCrafter
+{
+	bool StyleLibrary::addPack(const juce::File& file)
+	{
+		auto pack = StylePack::open(file);
+		if (!pack)
+			return false;
+
+		const juce::ScopedLock sl(lock);
+		packs.push_back(std::move(pack));
+		decoded.clear();
+		return true;
+	}
+
+	int StyleLibrary::loadDirectory(const juce::File& directory)
+	{
+		int loaded = 0;
+		if (!directory.isDirectory())
+			return loaded;
+
+		for (const auto& file : directory.findChildFiles(juce::File::findFiles, false,
+				juce::String("*") + StylePack::fileExtension))
+			if (addPack(file))
+				++loaded;
+		return loaded;
+	}
+
+	juce::StringArray StyleLibrary::getStyleNames() const
+	{
+		const juce::ScopedLock sl(lock);
+		juce::StringArray names;
+		for (const auto& pack : packs)
+			for (int i = 0; i < pack->getNumStyles(); ++i)
+				names.addIfNotAlreadyThere(pack->getName(i), true);
+		return names;
+	}
+
+	StyleLibrary::DefinitionPtr StyleLibrary::find(const juce::String& name) const
+	{
+		auto key = name.toLowerCase();
+		const juce::ScopedLock sl(lock);
+		auto cached = decoded.find(key);
+		if (cached != decoded.end())
+			return cached->second;
+
+		for (auto pack = packs.rbegin(); pack != packs.rend(); ++pack)
+		{
+			int index = (*pack)->indexOf(name);
+			StyleTable::StyleDefinition definition;
+			if (index >= 0 && (*pack)->load(index, definition))
+			{
+				auto shared = std::make_shared<const StyleTable::StyleDefinition>(definition);
+				decoded[key] = shared;
+				return shared;
+			}
+		}
+		return nullptr;
+	}
+
+	juce::File StyleLibrary::getDefaultDirectory()
+	{
+		return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+			.getChildFile("BeatCrafter")
+			.getChildFile("Styles");
+	}
+}
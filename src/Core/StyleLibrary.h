@@ -0,0 +1,31 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "StylePack.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace BeatCrafter
+{
+	// Named styles from every loaded StylePack. Packs added later shadow
+	// earlier ones with the same style name. Definitions are decoded on
+	// first lookup and shared from then on.
+	class StyleLibrary
+	{
+	public:
+		using DefinitionPtr = std::shared_ptr<const StyleTable::StyleDefinition>;
+
+		bool addPack(const juce::File& file);
+		int loadDirectory(const juce::File& directory);
+
+		juce::StringArray getStyleNames() const;
+		DefinitionPtr find(const juce::String& name) const;
+
+		static juce::File getDefaultDirectory();
+
+	private:
+		mutable juce::CriticalSection lock;
+		std::vector<std::unique_ptr<StylePack>> packs;
+		mutable std::map<juce::String, DefinitionPtr> decoded;
+	};
+}
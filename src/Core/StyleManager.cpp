@@ -1,48 +1,168 @@
 #include "StyleManager.h"
+#include "StepKernels.h"
+#include "Styles/RockStyle.h"
+#include "Styles/MetalStyle.h"
+#include "Styles/JazzStyle.h"
+#include "Styles/FunkStyle.h"
+#include "Styles/ElectronicStyle.h"
+#include "Styles/HipHopStyle.h"
+#include "Styles/LatinStyle.h"
+#include "Styles/PunkStyle.h"
 #include <algorithm>
 
 namespace BeatCrafter
 {
 
-	void StyleManager::generateBasicPattern(Pattern &pattern, StyleType style)
+	namespace
 	{
-		pattern.clear();
-		switch (style)
+		using StyleTable::templateSteps;
+		constexpr uint32_t barSeedStride = 0x9e3779b9u;
+
+		bool isCanonicalGrid(const Pattern &pattern)
 		{
-		case StyleType::Rock:
-			generateRockPattern(pattern);
-			break;
-		case StyleType::Metal:
-			generateMetalPattern(pattern);
-			break;
-		case StyleType::Jazz:
-			generateJazzPattern(pattern);
-			break;
-		case StyleType::Funk:
-			generateFunkPattern(pattern);
-			break;
-		case StyleType::Electronic:
-			generateElectronicPattern(pattern);
-			break;
-		case StyleType::HipHop:
-			generateHipHopPattern(pattern);
-			break;
-		case StyleType::Latin:
-			generateLatinPattern(pattern);
-			break;
-		case StyleType::Punk:
-			generatePunkPattern(pattern);
-			break;
-		default:
-			generateRockPattern(pattern);
-			break;
+			auto signature = pattern.getTimeSignature();
+			return pattern.getLength() == templateSteps
+				&& signature.getStepsPerBar() == templateSteps
+				&& signature.stepsPerQuarter == 4;
 		}
+
+		// Step within the bar that 16th-note template step k lands on, or -1 when the grid has no step there.
+		int getGridStep(int templateStep, const TimeSignature &signature)
+		{
+			int scaled = templateStep * signature.stepsPerQuarter;
+			if (scaled % 4 != 0)
+				return -1;
+			int gridStep = scaled / 4;
+			return gridStep < signature.getStepsPerBar() ? gridStep : -1;
+		}
+
+		bool isTemplateStep(int stepInBar, const TimeSignature &signature)
+		{
+			int scaled = stepInBar * 4;
+			return scaled % signature.stepsPerQuarter == 0 && scaled / signature.stepsPerQuarter < templateSteps;
+		}
+
+		Pattern extractBar(const Pattern &source, int bar)
+		{
+			Pattern barTemplate(source.getName());
+			barTemplate.setSwing(source.getSwing());
+			auto signature = source.getTimeSignature();
+			int barStart = bar * signature.getStepsPerBar();
+			int numTracks = juce::jmin(source.getNumTracks(), barTemplate.getNumTracks());
+
+			for (int k = 0; k < templateSteps; ++k)
+			{
+				int gridStep = getGridStep(k, signature);
+				if (gridStep < 0 || barStart + gridStep >= source.getLength())
+					continue;
+				for (int t = 0; t < numTracks; ++t)
+					barTemplate.getTrack(t).getStep(k) = *source.getTrack(t).getStep(barStart + gridStep);
+			}
+			return barTemplate;
+		}
+
+		void projectBar(const Pattern &barTemplate, Pattern &target, int bar)
+		{
+			auto signature = target.getTimeSignature();
+			int barStart = bar * signature.getStepsPerBar();
+			int numTracks = juce::jmin(target.getNumTracks(), barTemplate.getNumTracks());
+
+			for (int k = 0; k < templateSteps; ++k)
+			{
+				int gridStep = getGridStep(k, signature);
+				if (gridStep < 0 || barStart + gridStep >= target.getLength())
+					continue;
+				for (int t = 0; t < numTracks; ++t)
+					target.getTrack(t).getStep(barStart + gridStep) = *barTemplate.getTrack(t).getStep(k);
+			}
+		}
+	}
+
+	void StyleManager::generateBasicPattern(Pattern &pattern, StyleType style, uint32_t seed)
+	{
+		generateBasicPattern(pattern, getStyleDefinition(style), seed);
 	}
 
 	Pattern StyleManager::applyIntensity(const Pattern &basePattern, float intensity,
 										 StyleType style, uint32_t seed)
 	{
-		getRNG().seed(seed);
+		return applyIntensity(basePattern, intensity, getStyleDefinition(style), seed);
+	}
+
+	void StyleManager::applyComplexityToPattern(Pattern &pattern, StyleType style,
+												float complexity, uint32_t seed)
+	{
+		applyComplexityToPattern(pattern, getStyleDefinition(style), complexity, seed);
+	}
+
+	void StyleManager::generateBasicPattern(Pattern &pattern, const StyleTable::StyleDefinition &style, uint32_t seed)
+	{
+		if (isCanonicalGrid(pattern))
+		{
+			generateBasicBar(pattern, style, seed);
+			return;
+		}
+
+		Pattern barTemplate(pattern.getName());
+		generateBasicBar(barTemplate, style, seed);
+
+		pattern.clear();
+		for (int bar = 0; bar < pattern.getNumBars(); ++bar)
+			projectBar(barTemplate, pattern, bar);
+	}
+
+	void StyleManager::generateBasicBar(Pattern &pattern, const StyleTable::StyleDefinition &style, uint32_t seed)
+	{
+		RandomState rng(seed);
+		pattern.clear();
+
+		if (style.swing != StyleTable::keepSwing)
+			pattern.setSwing(style.swing);
+		applySection(pattern, style.pattern, 0.0f, rng);
+	}
+
+	Pattern StyleManager::applyIntensity(const Pattern &basePattern, float intensity,
+										 const StyleTable::StyleDefinition &style, uint32_t seed)
+	{
+		if (isCanonicalGrid(basePattern))
+		{
+			RandomState rng(seed);
+			return applyIntensityToBar(basePattern, intensity, style, rng);
+		}
+
+		Pattern result = basePattern;
+		auto signature = result.getTimeSignature();
+		int stepsPerBar = signature.getStepsPerBar();
+		bool keepOffGridSteps = intensity > 0.15f && !(intensity <= 0.4f && style.family == StyleType::Punk);
+
+		for (int bar = 0; bar < result.getNumBars(); ++bar)
+		{
+			RandomState rng(seed + static_cast<uint32_t>(bar) * barSeedStride);
+			projectBar(applyIntensityToBar(extractBar(basePattern, bar), intensity, style, rng), result, bar);
+		}
+
+		for (int t = 0; t < result.getNumTracks(); ++t)
+			for (int i = 0; i < result.getLength(); ++i)
+			{
+				auto step = result.getTrack(t).getStep(i);
+				if (!step.isActive() || isTemplateStep(i % stepsPerBar, signature))
+					continue;
+				if (!keepOffGridSteps)
+				{
+					step.setActive(false);
+					continue;
+				}
+				step.setVelocity(step.getVelocity() * (0.3f + intensity * 0.7f));
+				if (step.getProbability() < 1.0f)
+					step.setProbability(step.getProbability() * (0.7f + intensity * 0.3f));
+			}
+
+		return result;
+	}
+
+	Pattern StyleManager::applyIntensityToBar(const Pattern &basePattern, float intensity,
+											  const StyleTable::StyleDefinition &style, RandomState &rng)
+	{
 		Pattern result = basePattern;
 
 		if (intensity == 0.0f)
@@ -58,16 +178,16 @@ namespace BeatCrafter
 			for (int t = 0; t < result.getNumTracks(); ++t)
 				for (int i = 0; i < result.getLength(); ++i)
 					result.getTrack(t).getStep(i).setActive(false);
-			addSoftIntro(result, intensity, style);
+			addSoftIntro(result, intensity, style, rng);
 			return result;
 		}
 
-		if (intensity <= 0.4f && style == StyleType::Punk)
+		if (intensity <= 0.4f && style.family == StyleType::Punk)
 		{
 			for (int t = 0; t < result.getNumTracks(); ++t)
 				for (int i = 0; i < result.getLength(); ++i)
 					result.getTrack(t).getStep(i).setActive(false);
-			generatePunkIntro(result, intensity);
+			generatePunkIntro(result, intensity, rng);
 			return result;
 		}
 
@@ -75,118 +195,147 @@ namespace BeatCrafter
 
 		if (intensity > 0.9f)
 		{
-			addBreakMode(result, intensity, style);
+			addBreakMode(result, intensity, style, rng);
 		}
 		else
 		{
 			if (intensity > 0.1f)
-				addSubtleVariations(result, intensity, style);
+				addSubtleVariations(result, intensity, style, rng);
 			if (intensity > 0.3f)
-				changeSnarePattern(result, intensity, style);
+				changeSnarePattern(result, intensity, style, rng);
 			if (intensity > 0.4f)
-				addHiHatRideVariations(result, intensity, style);
+				addHiHatRideVariations(result, intensity, style, rng);
 			if (intensity > 0.5f)
-				addGhostNotes(result, 1, intensity * 0.7f);
+				addGhostNotes(result, 1, intensity * 0.7f, rng);
 			if (intensity > 0.7f)
-				addRandomFills(result, intensity);
+				addRandomFills(result, intensity, rng);
 		}
 
 		return result;
 	}
 
-	void StyleManager::changeSnarePattern(Pattern &pattern, float intensity, StyleType style)
+	void StyleManager::changeSnarePattern(Pattern &pattern, float intensity, const StyleTable::StyleDefinition &style, RandomState &rng)
 	{
-		switch (style)
-		{
-		case StyleType::Rock:
-			generateRockSnare(pattern, intensity);
-			break;
-		case StyleType::Metal:
-			generateMetalSnare(pattern, intensity);
-			break;
-		case StyleType::Jazz:
-			generateJazzSnare(pattern, intensity);
-			break;
-		case StyleType::Funk:
-			generateFunkSnare(pattern, intensity);
-			break;
-		case StyleType::Electronic:
-			generateElectronicSnare(pattern, intensity);
-			break;
-		case StyleType::HipHop:
-			generateHipHopSnare(pattern, intensity);
-			break;
-		case StyleType::Latin:
-			generateLatinSnare(pattern, intensity);
-			break;
-		case StyleType::Punk:
-			generatePunkSnare(pattern, intensity);
-			break;
-		}
+		applyBandedSection(pattern, style.snare, intensity, rng);
 	}
 
-	void StyleManager::addHiHatRideVariations(Pattern &pattern, float intensity, StyleType style)
+	void StyleManager::addHiHatRideVariations(Pattern &pattern, float intensity, const StyleTable::StyleDefinition &style, RandomState &rng)
 	{
-		switch (style)
-		{
-		case StyleType::Rock:
-			generateRockHiHat(pattern, intensity);
-			break;
-		case StyleType::Metal:
-			generateMetalHiHat(pattern, intensity);
-			break;
-		case StyleType::Jazz:
-			generateJazzHiHat(pattern, intensity);
-			break;
-		case StyleType::Funk:
-			generateFunkHiHat(pattern, intensity);
-			break;
-		case StyleType::Electronic:
-			generateElectronicHiHat(pattern, intensity);
-			break;
-		case StyleType::HipHop:
-			generateHipHopHiHat(pattern, intensity);
-			break;
-		case StyleType::Latin:
-			generateLatinHiHat(pattern, intensity);
-			break;
-		case StyleType::Punk:
-			generatePunkHiHat(pattern, intensity);
-			break;
-		}
+		applyBandedSection(pattern, style.hiHat, intensity, rng);
 	}
 
-	void StyleManager::addBreakMode(Pattern &pattern, float intensity, StyleType style)
+	void StyleManager::addBreakMode(Pattern &pattern, float intensity, const StyleTable::StyleDefinition &style, RandomState &rng)
 	{
-		if (!randomChance(0.6f))
+		if (!rng.nextChance(0.6f))
 			return;
 		clearCymbalsAndToms(pattern);
+		applySection(pattern, style.breakFill, intensity, rng);
+	}
+
+	const StyleTable::StyleDefinition &StyleManager::getStyleDefinition(StyleType style)
+	{
 		switch (style)
 		{
-		case StyleType::Rock:
-			generateRockBreak(pattern, intensity);
-			break;
 		case StyleType::Metal:
-			generateMetalBreak(pattern, intensity);
-			break;
+			return StyleTable::metalStyle;
 		case StyleType::Jazz:
-			generateJazzBreak(pattern, intensity);
-			break;
+			return StyleTable::jazzStyle;
 		case StyleType::Funk:
-			generateFunkBreak(pattern, intensity);
-			break;
+			return StyleTable::funkStyle;
 		case StyleType::Electronic:
-			generateElectronicBreak(pattern, intensity);
-			break;
+			return StyleTable::electronicStyle;
 		case StyleType::HipHop:
-			generateHipHopBreak(pattern, intensity);
-			break;
+			return StyleTable::hipHopStyle;
 		case StyleType::Latin:
-			generateLatinBreak(pattern, intensity);
-			break;
+			return StyleTable::latinStyle;
 		case StyleType::Punk:
-			generatePunkBreak(pattern, intensity);
-			break;
+			return StyleTable::punkStyle;
+		case StyleType::Rock:
+		default:
+			return StyleTable::rockStyle;
+		}
+	}
+
+	void StyleManager::applyBandedSection(Pattern &pattern, const StyleTable::BandedSection &banded,
+										  float intensity, RandomState &rng)
+	{
+		for (int t = 0; t < pattern.getNumTracks(); ++t)
+			if ((banded.clearTracks >> t) & 1u)
+				for (int i = 0; i < pattern.getLength(); ++i)
+					pattern.getTrack(t).getStep(i).setActive(false);
+
+		int band = 0;
+		while (band < banded.numBands - 1 && intensity > banded.bands[(size_t)band].maxIntensity)
+			++band;
+		applySection(pattern, banded.bands[(size_t)band].section, intensity, rng);
+	}
+
+	void StyleManager::applySection(Pattern &pattern, const StyleTable::Section &section,
+									float intensity, RandomState &rng)
+	{
+		using namespace StyleTable;
+
+		bool lastGatePassed = true;
+		int length = juce::jmin(pattern.getLength(), templateSteps);
+
+		for (const auto &rule : section.rules)
+		{
+			if (rule.kind == RuleKind::None)
+				break;
+
+			if (rule.gate == RuleGate::Chance)
+			{
+				lastGatePassed = rng.nextChance(rule.gateChance.evaluate(intensity));
+				if (!lastGatePassed)
+					continue;
+			}
+			else if (rule.gate == RuleGate::Otherwise && lastGatePassed)
+				continue;
+
+			if (rule.kind == RuleKind::GhostNotes)
+			{
+				addGhostNotes(pattern, rule.hits[0].track, rule.stepChance.evaluate(intensity), rng);
+				continue;
+			}
+
+			StepMask stepMask = rule.getStepMask();
+			for (int i = 0; i < length; ++i)
+			{
+				if (((stepMask >> i) & 1u) == 0)
+					continue;
+				if (rule.stepChance.isSet() && !rng.nextChance(rule.stepChance.evaluate(intensity)))
+					continue;
+
+				for (const auto &h : rule.hits)
+				{
+					if (h.steps == 0)
+						break;
+					if (((h.steps >> i) & 1u) == 0)
+						continue;
+					if (h.chance.isSet() && !rng.nextChance(h.chance.evaluate(intensity)))
+						continue;
+
+					auto step = pattern.getTrack(h.track).getStep(i);
+					step.setActive(true);
+					switch (h.velocity.mode)
+					{
+					case VelocityMode::Random:
+						step.setVelocity(rng.nextFloat(h.velocity.min, h.velocity.max));
+						break;
+					case VelocityMode::RandomPercent:
+						step.setVelocity(h.velocity.min + rng.nextInt(static_cast<int>(h.velocity.max)) / 100.0f);
+						break;
+					case VelocityMode::Fixed:
+						step.setVelocity(h.velocity.min);
+						break;
+					}
+					if (h.probability != keepProbability)
+						step.setProbability(h.probability);
+
+					if (rule.kind == RuleKind::FirstMatch)
+						break;
+				}
+			}
 		}
 	}
 
@@ -198,13 +347,13 @@ namespace BeatCrafter
 				pattern.getTrack(t).getStep(i).setActive(false);
 	}
 
-	void StyleManager::addSoftIntro(Pattern &pattern, float intensity, StyleType style)
+	void StyleManager::addSoftIntro(Pattern &pattern, float intensity, const StyleTable::StyleDefinition &style, RandomState &rng)
 	{
 		for (int t = 0; t < pattern.getNumTracks(); ++t)
 			for (int i = 0; i < pattern.getLength(); ++i)
 				pattern.getTrack(t).getStep(i).setActive(false);
 
-		switch (style)
+		switch (style.family)
 		{
 		case StyleType::Metal:
 		case StyleType::Jazz:
@@ -212,26 +361,26 @@ namespace BeatCrafter
 			auto &rideTrack = pattern.getTrack(5);
 			for (int i = 0; i < 16; i += 4)
 			{
-				if (randomChance(intensity * 4.0f))
+				if (rng.nextChance(intensity * 4.0f))
 				{
 					rideTrack.getStep(i).setActive(true);
-					rideTrack.getStep(i).setVelocity(randomFloat(0.2f, 0.3f + intensity));
+					rideTrack.getStep(i).setVelocity(rng.nextFloat(0.2f, 0.3f + intensity));
 				}
 			}
 			break;
 		}
 		case StyleType::Punk:
-			generatePunkIntro(pattern, intensity);
+			generatePunkIntro(pattern, intensity, rng);
 			break;
 		default:
 		{
 			auto &hihatTrack = pattern.getTrack(2);
 			for (int i = 2; i < 16; i += 4)
 			{
-				if (randomChance(intensity * 4.0f))
+				if (rng.nextChance(intensity * 4.0f))
 				{
 					hihatTrack.getStep(i).setActive(true);
-					hihatTrack.getStep(i).setVelocity(randomFloat(0.2f, 0.3f + intensity));
+					hihatTrack.getStep(i).setVelocity(rng.nextFloat(0.2f, 0.3f + intensity));
 				}
 			}
 			break;
@@ -241,65 +390,96 @@ namespace BeatCrafter
 
 	void StyleManager::applyBaseIntensityScaling(Pattern &pattern, float intensity)
 	{
+		float velocityGain = 0.3f + intensity * 0.7f;
+		float probabilityGain = 0.7f + intensity * 0.3f;
+
 		for (int t = 0; t < pattern.getNumTracks(); ++t)
 		{
 			auto &track = pattern.getTrack(t);
-			for (int i = 0; i < pattern.getLength(); ++i)
-			{
-				auto &step = track.getStep(i);
-				if (step.isActive())
-				{
-					step.setVelocity(step.getVelocity() * (0.3f + intensity * 0.7f));
-					if (step.getProbability() < 1.0f)
-						step.setProbability(step.getProbability() * (0.7f + intensity * 0.3f));
-				}
-			}
+			StepKernels::scaleActive(track.getActiveLane(), track.getVelocityLane(), track.getProbabilityLane(),
+									 track.getLength(), velocityGain, probabilityGain);
 		}
 	}
 
-	void StyleManager::addGhostNotes(Pattern &pattern, int track, float probability)
+	// The chance draw is only made for inactive steps and a hit draws two more
+	// values, so the walk over the random stream stays serial; the kernel
+	// merges the hits back.
+	void StyleManager::addGhostNotes(Pattern &pattern, int track, float probability, RandomState &rng)
 	{
+		constexpr int chunkSize = 256;
 		auto &t = pattern.getTrack(track);
-		for (int i = 0; i < pattern.getLength(); ++i)
+		std::array<uint32_t, chunkSize> hits;
+		std::array<float, chunkSize> hitVelocity, hitProbability;
+
+		for (int start = 0; start < t.getLength(); start += chunkSize)
 		{
-			if (!t.getStep(i).isActive() && randomChance(probability * 0.3f))
+			int count = juce::jmin(chunkSize, t.getLength() - start);
+			const uint32_t *active = t.getActiveLane() + start;
+			for (size_t i = 0; i < (size_t)count; ++i)
 			{
-				t.getStep(i).setActive(true);
-				t.getStep(i).setVelocity(randomFloat(0.2f, 0.4f));
-				t.getStep(i).setProbability(randomFloat(0.6f, 0.9f));
+				hits[i] = 0;
+				hitVelocity[i] = hitProbability[i] = 0.0f;
+				if (active[i] == 0 && rng.nextChance(probability * 0.3f))
+				{
+					hits[i] = 1;
+					hitVelocity[i] = rng.nextFloat(0.2f, 0.4f);
+					hitProbability[i] = rng.nextFloat(0.6f, 0.9f);
+				}
 			}
+
+			StepKernels::mergeHits(t.getActiveLane() + start, t.getVelocityLane() + start, t.getProbabilityLane() + start,
+								   hits.data(), hitVelocity.data(), hitProbability.data(), count);
 		}
 	}
 
-	void StyleManager::addRandomFills(Pattern &pattern, float intensity)
+	void StyleManager::addRandomFills(Pattern &pattern, float intensity, RandomState &rng)
 	{
-		if (!randomChance(intensity * 0.6f))
+		if (!rng.nextChance(intensity * 0.6f))
 			return;
 		auto &tomHi = pattern.getTrack(6);
 		auto &tomLo = pattern.getTrack(7);
-		int fillStart = 12 + static_cast<int>(randomFloat(0.f, 4.f));
+		int fillStart = 12 + static_cast<int>(rng.nextFloat(0.f, 4.f));
 		for (int i = fillStart; i < 16; ++i)
 		{
-			if (randomChance(0.6f))
+			if (rng.nextChance(0.6f))
 			{
-				if (randomChance(0.5f))
+				if (rng.nextChance(0.5f))
 				{
 					tomHi.getStep(i).setActive(true);
-					tomHi.getStep(i).setVelocity(randomFloat(0.6f, 0.9f));
+					tomHi.getStep(i).setVelocity(rng.nextFloat(0.6f, 0.9f));
 				}
 				else
 				{
 					tomLo.getStep(i).setActive(true);
-					tomLo.getStep(i).setVelocity(randomFloat(0.6f, 0.9f));
+					tomLo.getStep(i).setVelocity(rng.nextFloat(0.6f, 0.9f));
 				}
 			}
 		}
 	}
 
-	void StyleManager::applyComplexityToPattern(Pattern &pattern, StyleType style,
+	void StyleManager::applyComplexityToPattern(Pattern &pattern, const StyleTable::StyleDefinition &style,
 												float complexity, uint32_t seed)
 	{
-		switch (style)
+		if (isCanonicalGrid(pattern))
+		{
+			RandomState rng(seed);
+			applyComplexityToBar(pattern, style, complexity, rng);
+			return;
+		}
+
+		for (int bar = 0; bar < pattern.getNumBars(); ++bar)
+		{
+			auto barTemplate = extractBar(pattern, bar);
+			RandomState rng(seed + static_cast<uint32_t>(bar) * barSeedStride);
+			applyComplexityToBar(barTemplate, style, complexity, rng);
+			projectBar(barTemplate, pattern, bar);
+		}
+	}
+
+	void StyleManager::applyComplexityToBar(Pattern &pattern, const StyleTable::StyleDefinition &style,
+											float complexity, RandomState &rng)
+	{
+		switch (style.family)
 		{
 		case StyleType::Rock:
 			if (complexity > 0.5f)
@@ -403,18 +583,16 @@ namespace BeatCrafter
 			break;
 		}
 
-		std::mt19937 rng(seed);
-		std::uniform_real_distribution<float> velVar(-0.1f, 0.1f);
 		for (int t = 0; t < pattern.getNumTracks(); ++t)
 			for (int i = 0; i < pattern.getLength(); ++i)
 			{
-				auto &step = pattern.getTrack(t).getStep(i);
+				auto step = pattern.getTrack(t).getStep(i);
 				if (step.isActive())
-					step.setVelocity(juce::jlimit(0.3f, 1.0f, step.getVelocity() + velVar(rng)));
+					step.setVelocity(juce::jlimit(0.3f, 1.0f, step.getVelocity() + rng.nextFloat(-0.1f, 0.1f)));
 			}
 	}
 
-	void StyleManager::addSubtleVariations(Pattern &pattern, float intensity, StyleType style)
+	void StyleManager::addSubtleVariations(Pattern &pattern, float intensity, const StyleTable::StyleDefinition &style, RandomState &rng)
 	{
 		auto &kickTrack = pattern.getTrack(0);
 		auto &snareTrack = pattern.getTrack(1);
@@ -422,58 +600,58 @@ namespace BeatCrafter
 
 		for (int i = 0; i < pattern.getLength(); ++i)
 		{
-			if (kickTrack.getStep(i).isActive() && randomChance(intensity * 0.15f))
-				kickTrack.getStep(i).setVelocity(kickTrack.getStep(i).getVelocity() + randomFloat(-0.05f, 0.08f));
-			if (snareTrack.getStep(i).isActive() && randomChance(intensity * 0.12f))
-				snareTrack.getStep(i).setVelocity(snareTrack.getStep(i).getVelocity() + randomFloat(-0.04f, 0.1f));
+			if (kickTrack.getStep(i).isActive() && rng.nextChance(intensity * 0.15f))
+				kickTrack.getStep(i).setVelocity(kickTrack.getStep(i).getVelocity() + rng.nextFloat(-0.05f, 0.08f));
+			if (snareTrack.getStep(i).isActive() && rng.nextChance(intensity * 0.12f))
+				snareTrack.getStep(i).setVelocity(snareTrack.getStep(i).getVelocity() + rng.nextFloat(-0.04f, 0.1f));
 		}
 
 		if (intensity > 0.1f)
 			for (int i = 0; i < 16; ++i)
-				if (!hihatTrack.getStep(i).isActive() && randomChance(intensity * 0.25f))
+				if (!hihatTrack.getStep(i).isActive() && rng.nextChance(intensity * 0.25f))
 				{
 					hihatTrack.getStep(i).setActive(true);
-					hihatTrack.getStep(i).setVelocity(randomFloat(0.3f, 0.5f));
+					hihatTrack.getStep(i).setVelocity(rng.nextFloat(0.3f, 0.5f));
 					hihatTrack.getStep(i).setProbability(0.5f + intensity * 0.3f);
 				}
 
 		for (int i = 1; i < 16; ++i)
-			if (!kickTrack.getStep(i).isActive() && randomChance(intensity * 0.1f))
+			if (!kickTrack.getStep(i).isActive() && rng.nextChance(intensity * 0.1f))
 			{
 				kickTrack.getStep(i).setActive(true);
-				kickTrack.getStep(i).setVelocity(randomFloat(0.35f, 0.55f));
+				kickTrack.getStep(i).setVelocity(rng.nextFloat(0.35f, 0.55f));
 				kickTrack.getStep(i).setProbability(0.5f + intensity * 0.3f);
 			}
 
-		if (style == StyleType::Metal && intensity > 0.3f)
+		if (style.family == StyleType::Metal && intensity > 0.3f)
 		{
 			float dkChance = (intensity - 0.3f) * 1.2f;
 			for (int i = 0; i < 16; ++i)
-				if (kickTrack.getStep(i).isActive() && randomChance(dkChance))
+				if (kickTrack.getStep(i).isActive() && rng.nextChance(dkChance))
 				{
 					int next = (i + 1) % 16;
 					if (!kickTrack.getStep(next).isActive())
 					{
 						kickTrack.getStep(next).setActive(true);
-						kickTrack.getStep(next).setVelocity(randomFloat(0.7f, 0.9f));
+						kickTrack.getStep(next).setVelocity(rng.nextFloat(0.7f, 0.9f));
 						kickTrack.getStep(next).setProbability(0.6f + intensity * 0.3f);
 					}
 				}
 			if (intensity > 0.7f)
 				for (int i = 0; i < 16; i += 2)
-					if (randomChance(dkChance * 0.8f))
+					if (rng.nextChance(dkChance * 0.8f))
 					{
 						kickTrack.getStep(i).setActive(true);
-						kickTrack.getStep(i).setVelocity(randomFloat(0.8f, 0.95f));
+						kickTrack.getStep(i).setVelocity(rng.nextFloat(0.8f, 0.95f));
 						if (i + 1 < 16)
 						{
 							kickTrack.getStep(i + 1).setActive(true);
-							kickTrack.getStep(i + 1).setVelocity(randomFloat(0.75f, 0.9f));
+							kickTrack.getStep(i + 1).setVelocity(rng.nextFloat(0.75f, 0.9f));
 						}
 					}
 		}
 
-		if (style == StyleType::Electronic && intensity > 0.3f)
+		if (style.family == StyleType::Electronic && intensity > 0.3f)
 		{
 			kickTrack.getStep(0).setActive(true);
 			kickTrack.getStep(4).setActive(true);
@@ -481,97 +659,140 @@ namespace BeatCrafter
 			kickTrack.getStep(12).setActive(true);
 			if (intensity > 0.6f)
 				for (int i = 2; i < 16; i += 4)
-					if (randomChance(intensity * 0.4f))
+					if (rng.nextChance(intensity * 0.4f))
 					{
 						kickTrack.getStep(i).setActive(true);
-						kickTrack.getStep(i).setVelocity(randomFloat(0.5f, 0.7f));
+						kickTrack.getStep(i).setVelocity(rng.nextFloat(0.5f, 0.7f));
 						kickTrack.getStep(i).setProbability(0.6f + intensity * 0.3f);
 					}
 		}
 
-		if (style == StyleType::Punk && intensity > 0.2f)
+		if (style.family == StyleType::Punk && intensity > 0.2f)
 		{
 			for (int i = 0; i < 16; ++i)
 				kickTrack.getStep(i).setActive(false);
 			if (intensity <= 0.3f)
 			{
 				kickTrack.getStep(0).setActive(true);
-				kickTrack.getStep(0).setVelocity(randomFloat(0.5f, 0.65f));
+				kickTrack.getStep(0).setVelocity(rng.nextFloat(0.5f, 0.65f));
 			}
 			else if (intensity <= 0.4f)
 			{
 				kickTrack.getStep(0).setActive(true);
-				kickTrack.getStep(0).setVelocity(randomFloat(0.6f, 0.75f));
+				kickTrack.getStep(0).setVelocity(rng.nextFloat(0.6f, 0.75f));
 				kickTrack.getStep(8).setActive(true);
-				kickTrack.getStep(8).setVelocity(randomFloat(0.55f, 0.7f));
+				kickTrack.getStep(8).setVelocity(rng.nextFloat(0.55f, 0.7f));
 			}
 			else if (intensity <= 0.5f)
 			{
 				kickTrack.getStep(0).setActive(true);
-				kickTrack.getStep(0).setVelocity(randomFloat(0.7f, 0.8f));
+				kickTrack.getStep(0).setVelocity(rng.nextFloat(0.7f, 0.8f));
 				kickTrack.getStep(4).setActive(true);
-				kickTrack.getStep(4).setVelocity(randomFloat(0.6f, 0.7f));
+				kickTrack.getStep(4).setVelocity(rng.nextFloat(0.6f, 0.7f));
 				kickTrack.getStep(8).setActive(true);
-				kickTrack.getStep(8).setVelocity(randomFloat(0.7f, 0.8f));
+				kickTrack.getStep(8).setVelocity(rng.nextFloat(0.7f, 0.8f));
 				kickTrack.getStep(12).setActive(true);
-				kickTrack.getStep(12).setVelocity(randomFloat(0.6f, 0.7f));
+				kickTrack.getStep(12).setVelocity(rng.nextFloat(0.6f, 0.7f));
 			}
 			else if (intensity <= 0.7f)
 			{
 				kickTrack.getStep(0).setActive(true);
-				kickTrack.getStep(0).setVelocity(randomFloat(0.75f, 0.85f));
+				kickTrack.getStep(0).setVelocity(rng.nextFloat(0.75f, 0.85f));
 				kickTrack.getStep(4).setActive(true);
-				kickTrack.getStep(4).setVelocity(randomFloat(0.7f, 0.8f));
-				if (randomChance(0.6f))
+				kickTrack.getStep(4).setVelocity(rng.nextFloat(0.7f, 0.8f));
+				if (rng.nextChance(0.6f))
 				{
 					kickTrack.getStep(5).setActive(true);
-					kickTrack.getStep(5).setVelocity(randomFloat(0.65f, 0.75f));
+					kickTrack.getStep(5).setVelocity(rng.nextFloat(0.65f, 0.75f));
 				}
 				kickTrack.getStep(8).setActive(true);
-				kickTrack.getStep(8).setVelocity(randomFloat(0.75f, 0.85f));
+				kickTrack.getStep(8).setVelocity(rng.nextFloat(0.75f, 0.85f));
 				kickTrack.getStep(12).setActive(true);
-				kickTrack.getStep(12).setVelocity(randomFloat(0.7f, 0.8f));
-				if (randomChance(0.6f))
+				kickTrack.getStep(12).setVelocity(rng.nextFloat(0.7f, 0.8f));
+				if (rng.nextChance(0.6f))
 				{
 					kickTrack.getStep(13).setActive(true);
-					kickTrack.getStep(13).setVelocity(randomFloat(0.65f, 0.75f));
+					kickTrack.getStep(13).setVelocity(rng.nextFloat(0.65f, 0.75f));
 				}
 			}
 			else
 			{
 				kickTrack.getStep(0).setActive(true);
-				kickTrack.getStep(0).setVelocity(randomFloat(0.85f, 0.95f));
+				kickTrack.getStep(0).setVelocity(rng.nextFloat(0.85f, 0.95f));
 				kickTrack.getStep(4).setActive(true);
-				kickTrack.getStep(4).setVelocity(randomFloat(0.8f, 0.9f));
+				kickTrack.getStep(4).setVelocity(rng.nextFloat(0.8f, 0.9f));
 				kickTrack.getStep(5).setActive(true);
-				kickTrack.getStep(5).setVelocity(randomFloat(0.75f, 0.85f));
+				kickTrack.getStep(5).setVelocity(rng.nextFloat(0.75f, 0.85f));
 				kickTrack.getStep(8).setActive(true);
-				kickTrack.getStep(8).setVelocity(randomFloat(0.85f, 0.95f));
+				kickTrack.getStep(8).setVelocity(rng.nextFloat(0.85f, 0.95f));
 				kickTrack.getStep(12).setActive(true);
-				kickTrack.getStep(12).setVelocity(randomFloat(0.8f, 0.9f));
+				kickTrack.getStep(12).setVelocity(rng.nextFloat(0.8f, 0.9f));
 				kickTrack.getStep(13).setActive(true);
-				kickTrack.getStep(13).setVelocity(randomFloat(0.75f, 0.85f));
+				kickTrack.getStep(13).setVelocity(rng.nextFloat(0.75f, 0.85f));
 			}
 		}
 	}
 
-	std::mt19937 &StyleManager::getRNG()
+	void StyleManager::generatePunkIntro(Pattern &pattern, float intensity, RandomState &rng)
 	{
-		static std::random_device rd;
-		static std::mt19937 gen(rd());
-		return gen;
-	}
-
-	float StyleManager::randomFloat(float min, float max)
-	{
-		std::uniform_real_distribution<float> dis(min, max);
-		return dis(getRNG());
-	}
+		auto &tomHi = pattern.getTrack(6);
+		auto &tomLo = pattern.getTrack(7);
 
-	bool StyleManager::randomChance(float probability)
-	{
-		std::uniform_real_distribution<float> dis(0.0f, 1.0f);
-		return dis(getRNG()) < probability;
+		if (intensity <= 0.05f)
+		{
+			for (int i = 0; i < 16; ++i)
+			{
+				tomLo.getStep(i).setActive(true);
+				tomLo.getStep(i).setVelocity(0.1f + sin((float)i * 0.8f) * 0.05f + rng.nextFloat(-0.02f, 0.02f));
+				tomLo.getStep(i).setProbability(0.7f);
+			}
+		}
+		else if (intensity <= 0.10f)
+		{
+			for (int i = 0; i < 16; ++i)
+			{
+				float base = 0.15f + intensity * 0.5f;
+				float cresc = (i < 4) ? (float)i / 4.0f * 0.1f : (i >= 8 && i < 12) ? (float)(i - 8) / 4.0f * 0.15f
+					: 0.0f;
+				float accent = (i % 4 == 0) ? 0.1f : 0.0f;
+				tomLo.getStep(i).setActive(true);
+				tomLo.getStep(i).setVelocity(std::min(base + cresc + accent + rng.nextFloat(-0.03f, 0.03f), 0.4f));
+				if ((i == 3 || i == 7 || i == 11 || i == 15) && rng.nextChance(0.5f))
+				{
+					tomHi.getStep(i).setActive(true);
+					tomHi.getStep(i).setVelocity(tomLo.getStep(i).getVelocity() * 0.8f);
+					tomHi.getStep(i).setProbability(0.7f);
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < 16; ++i)
+			{
+				float base = 0.2f + intensity * 1.5f;
+				float cresc = i < 8 ? (float)i / 8.0f * 0.15f : (float)(i - 8) / 8.0f * 0.2f;
+				float accent = (i == 0 || i == 8) ? 0.15f : (i % 2 == 0 ? 0.08f : 0.0f);
+				float vel = std::min(base + cresc + accent + rng.nextFloat(-0.04f, 0.04f), 0.5f);
+				tomLo.getStep(i).setActive(true);
+				tomLo.getStep(i).setVelocity(vel);
+				bool useHi = (i % 4 == 1 || i % 4 == 3) ? rng.nextChance(0.6f) : (i == 7 || i == 15);
+				if (useHi)
+				{
+					tomHi.getStep(i).setActive(true);
+					tomHi.getStep(i).setVelocity(vel * 0.9f);
+					tomLo.getStep(i).setVelocity(vel * 0.6f);
+				}
+			}
+			if (rng.nextChance(0.4f))
+			{
+				int flamPos = rng.nextChance(0.5f) ? 7 : 15;
+				tomLo.getStep(flamPos).setVelocity(tomLo.getStep(flamPos).getVelocity() * 1.2f);
+				if (flamPos > 0)
+				{
+					tomHi.getStep(flamPos - 1).setActive(true);
+					tomHi.getStep(flamPos - 1).setVelocity(0.25f);
+				}
+			}
+		}
 	}
-
-}
\ No newline at end of file
+}
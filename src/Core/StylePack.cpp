@@ -0,0 +1,369 @@
+#include "StylePack.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace BeatCrafter
+{
+	// Record encoding, in order:
+	//   uint8 family, float swing, Section pattern, BandedSection snare,
+	//   BandedSection hiHat, Section breakFill
+	// Section:       uint8 numRules, numRules x Rule
+	// Rule:          uint8 kind, uint8 gate, Chance gateChance, Chance stepChance, uint8 numHits, numHits x Hit
+	// Hit:           uint8 track, uint16 steps, uint8 velocityMode, float min, float max, float probability, Chance chance
+	// BandedSection: uint16 clearTracks, uint8 numBands, numBands x { float maxIntensity, Section }
+	// Chance:        float base, float perIntensity
+	// Trailing unused rules and hits are not stored.
+	namespace
+	{
+		using namespace StyleTable;
+
+		constexpr char magic[4] = { 'B', 'C', 'S', 'P' };
+
+		void writeChance(juce::OutputStream& out, const Chance& chance)
+		{
+			out.writeFloat(chance.base);
+			out.writeFloat(chance.perIntensity);
+		}
+
+		bool isEmpty(const Hit& h) { return h.track == 0 && h.steps == 0; }
+
+		void writeSection(juce::OutputStream& out, const Section& section)
+		{
+			int numRules = 0;
+			while (numRules < maxRulesPerSection && section.rules[(size_t)numRules].kind != RuleKind::None)
+				++numRules;
+
+			out.writeByte((char)numRules);
+			for (int r = 0; r < numRules; ++r)
+			{
+				const auto& rule = section.rules[(size_t)r];
+				int numHits = maxHitsPerRule;
+				while (numHits > 0 && isEmpty(rule.hits[(size_t)numHits - 1]))
+					--numHits;
+
+				out.writeByte((char)rule.kind);
+				out.writeByte((char)rule.gate);
+				writeChance(out, rule.gateChance);
+				writeChance(out, rule.stepChance);
+				out.writeByte((char)numHits);
+				for (int i = 0; i < numHits; ++i)
+				{
+					const auto& h = rule.hits[(size_t)i];
+					out.writeByte((char)h.track);
+					out.writeShort((short)h.steps);
+					out.writeByte((char)h.velocity.mode);
+					out.writeFloat(h.velocity.min);
+					out.writeFloat(h.velocity.max);
+					out.writeFloat(h.probability);
+					writeChance(out, h.chance);
+				}
+			}
+		}
+
+		void writeBandedSection(juce::OutputStream& out, const BandedSection& banded)
+		{
+			out.writeShort((short)banded.clearTracks);
+			out.writeByte((char)banded.numBands);
+			for (int b = 0; b < banded.numBands; ++b)
+			{
+				out.writeFloat(banded.bands[(size_t)b].maxIntensity);
+				writeSection(out, banded.bands[(size_t)b].section);
+			}
+		}
+
+		void writeDefinition(juce::OutputStream& out, const StyleDefinition& style)
+		{
+			out.writeByte((char)style.family);
+			out.writeFloat(style.swing);
+			writeSection(out, style.pattern);
+			writeBandedSection(out, style.snare);
+			writeBandedSection(out, style.hiHat);
+			writeSection(out, style.breakFill);
+		}
+
+		// Bounds-checked cursor over a mapped record; any overrun or
+		// non-finite float clears ok and yields zeros from then on.
+		struct RecordReader
+		{
+			const juce::uint8* position;
+			const juce::uint8* end;
+			bool ok = true;
+
+			bool canRead(size_t bytes)
+			{
+				ok = ok && (size_t)(end - position) >= bytes;
+				return ok;
+			}
+
+			juce::uint8 readByte()
+			{
+				return canRead(1) ? *position++ : 0;
+			}
+
+			juce::uint16 readShort()
+			{
+				if (!canRead(2))
+					return 0;
+				auto value = juce::ByteOrder::littleEndianShort(position);
+				position += 2;
+				return value;
+			}
+
+			float readFloat()
+			{
+				if (!canRead(4))
+					return 0.0f;
+				auto bits = juce::ByteOrder::littleEndianInt(position);
+				position += 4;
+				float value;
+				std::memcpy(&value, &bits, sizeof(value));
+				ok = ok && std::isfinite(value);
+				return value;
+			}
+
+			Chance readChance()
+			{
+				Chance chance;
+				chance.base = readFloat();
+				chance.perIntensity = readFloat();
+				return chance;
+			}
+		};
+
+		bool readSection(RecordReader& in, Section& section)
+		{
+			int numRules = in.readByte();
+			if (numRules > maxRulesPerSection)
+				return false;
+
+			for (int r = 0; r < numRules && in.ok; ++r)
+			{
+				auto& rule = section.rules[(size_t)r];
+				auto kind = in.readByte();
+				auto gate = in.readByte();
+				if (kind == (juce::uint8)RuleKind::None || kind > (juce::uint8)RuleKind::GhostNotes
+					|| gate > (juce::uint8)RuleGate::Otherwise)
+					return false;
+
+				rule.kind = (RuleKind)kind;
+				rule.gate = (RuleGate)gate;
+				rule.gateChance = in.readChance();
+				rule.stepChance = in.readChance();
+
+				int numHits = in.readByte();
+				if (numHits > maxHitsPerRule)
+					return false;
+
+				for (int i = 0; i < numHits && in.ok; ++i)
+				{
+					auto& h = rule.hits[(size_t)i];
+					h.track = in.readByte();
+					h.steps = in.readShort();
+					auto mode = in.readByte();
+					if (mode > (juce::uint8)VelocityMode::RandomPercent)
+						return false;
+					h.velocity.mode = (VelocityMode)mode;
+					h.velocity.min = in.readFloat();
+					h.velocity.max = in.readFloat();
+					h.probability = in.readFloat();
+					h.chance = in.readChance();
+				}
+			}
+			return in.ok;
+		}
+
+		bool readBandedSection(RecordReader& in, BandedSection& banded)
+		{
+			banded.clearTracks = in.readShort();
+			banded.numBands = in.readByte();
+			if (banded.numBands > maxBands)
+				return false;
+
+			for (int b = 0; b < banded.numBands && in.ok; ++b)
+			{
+				banded.bands[(size_t)b].maxIntensity = in.readFloat();
+				if (!readSection(in, banded.bands[(size_t)b].section))
+					return false;
+			}
+			return in.ok;
+		}
+	}
+
+	StylePack::StylePack(std::unique_ptr<juce::MemoryMappedFile> mappedFile, int numStylesToUse, size_t indexOffsetToUse)
+		: file(std::move(mappedFile)),
+		  data(static_cast<const juce::uint8*>(file->getData())),
+		  numStyles(numStylesToUse),
+		  indexOffset(indexOffsetToUse)
+	{
+	}
+
+	std::unique_ptr<StylePack> StylePack::open(const juce::File& source)
+	{
+		auto mapped = std::make_unique<juce::MemoryMappedFile>(source, juce::MemoryMappedFile::readOnly);
+		auto* bytes = static_cast<const juce::uint8*>(mapped->getData());
+		size_t fileSize = mapped->getSize();
+
+		if (bytes == nullptr || fileSize < headerSize || std::memcmp(bytes, magic, sizeof(magic)) != 0)
+			return nullptr;
+		if (juce::ByteOrder::littleEndianInt(bytes + 4) != formatVersion)
+			return nullptr;
+
+		size_t count = juce::ByteOrder::littleEndianInt(bytes + 8);
+		size_t index = juce::ByteOrder::littleEndianInt(bytes + 12);
+		if (index < headerSize || index > fileSize || count > (fileSize - index) / indexEntrySize)
+			return nullptr;
+
+		juce::uint32 previousHash = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const auto* entry = bytes + index + i * indexEntrySize;
+			auto hash = juce::ByteOrder::littleEndianInt(entry);
+			size_t nameOffset = juce::ByteOrder::littleEndianInt(entry + 4);
+			size_t recordOffset = juce::ByteOrder::littleEndianInt(entry + 8);
+			size_t nameLength = juce::ByteOrder::littleEndianShort(entry + 12);
+			size_t recordLength = juce::ByteOrder::littleEndianShort(entry + 14);
+
+			if (hash < previousHash
+				|| nameOffset > fileSize || nameLength > fileSize - nameOffset
+				|| recordOffset > fileSize || recordLength > fileSize - recordOffset)
+				return nullptr;
+			previousHash = hash;
+		}
+
+		return std::unique_ptr<StylePack>(new StylePack(std::move(mapped), (int)count, index));
+	}
+
+	juce::String StylePack::getName(int index) const
+	{
+		if (index < 0 || index >= numStyles)
+			return {};
+
+		const auto* entry = getIndexEntry(index);
+		return juce::String::fromUTF8(reinterpret_cast<const char*>(data + juce::ByteOrder::littleEndianInt(entry + 4)),
+									  (int)juce::ByteOrder::littleEndianShort(entry + 12));
+	}
+
+	int StylePack::indexOf(const juce::String& name) const
+	{
+		auto hash = hashName(name);
+		int low = 0;
+		int high = numStyles;
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (juce::ByteOrder::littleEndianInt(getIndexEntry(mid)) < hash)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+
+		for (int i = low; i < numStyles && juce::ByteOrder::littleEndianInt(getIndexEntry(i)) == hash; ++i)
+			if (getName(i).equalsIgnoreCase(name))
+				return i;
+		return -1;
+	}
+
+	bool StylePack::load(int index, StyleTable::StyleDefinition& definition) const
+	{
+		if (index < 0 || index >= numStyles)
+			return false;
+
+		const auto* entry = getIndexEntry(index);
+		const auto* record = data + juce::ByteOrder::littleEndianInt(entry + 8);
+		RecordReader in{ record, record + juce::ByteOrder::littleEndianShort(entry + 14) };
+
+		StyleTable::StyleDefinition decoded;
+		auto family = in.readByte();
+		if (family > (juce::uint8)StyleType::Punk)
+			return false;
+		decoded.family = (StyleType)family;
+		decoded.swing = in.readFloat();
+
+		if (!readSection(in, decoded.pattern)
+			|| !readBandedSection(in, decoded.snare)
+			|| !readBandedSection(in, decoded.hiHat)
+			|| !readSection(in, decoded.breakFill)
+			|| in.position != in.end
+			|| !StyleTable::isValid(decoded))
+			return false;
+
+		definition = decoded;
+		return true;
+	}
+
+	juce::uint32 StylePack::hashName(const juce::String& name)
+	{
+		auto lowerCase = name.toLowerCase();
+		juce::uint32 hash = 2166136261u;
+		for (const char* c = lowerCase.toRawUTF8(); *c != 0; ++c)
+		{
+			hash ^= (juce::uint8)*c;
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	bool StylePack::write(const std::vector<Entry>& styles, juce::OutputStream& stream)
+	{
+		struct Record
+		{
+			juce::uint32 hash;
+			const Entry* entry;
+		};
+
+		std::vector<Record> sorted;
+		sorted.reserve(styles.size());
+		for (const auto& style : styles)
+		{
+			if (style.name.isEmpty() || !StyleTable::isValid(style.definition))
+				return false;
+			sorted.push_back({ hashName(style.name), &style });
+		}
+		std::stable_sort(sorted.begin(), sorted.end(),
+			[](const Record& a, const Record& b) { return a.hash < b.hash; });
+
+		for (size_t i = 1; i < sorted.size(); ++i)
+			for (size_t j = i; j-- > 0 && sorted[j].hash == sorted[i].hash;)
+				if (sorted[j].entry->name.equalsIgnoreCase(sorted[i].entry->name))
+					return false;
+
+		juce::MemoryOutputStream names, records;
+		std::vector<std::array<size_t, 4>> ranges;
+		for (const auto& record : sorted)
+		{
+			auto nameStart = names.getDataSize();
+			names.write(record.entry->name.toRawUTF8(), record.entry->name.getNumBytesAsUTF8());
+			auto recordStart = records.getDataSize();
+			writeDefinition(records, record.entry->definition);
+
+			auto nameLength = names.getDataSize() - nameStart;
+			auto recordLength = records.getDataSize() - recordStart;
+			if (nameLength > 0xffff || recordLength > 0xffff)
+				return false;
+			ranges.push_back({ nameStart, nameLength, recordStart, recordLength });
+		}
+
+		size_t namesOffset = headerSize + sorted.size() * indexEntrySize;
+		size_t recordsOffset = namesOffset + names.getDataSize();
+		if (recordsOffset + records.getDataSize() > 0xffffffffu)
+			return false;
+
+		stream.write(magic, sizeof(magic));
+		stream.writeInt((int)formatVersion);
+		stream.writeInt((int)sorted.size());
+		stream.writeInt((int)headerSize);
+
+		for (size_t i = 0; i < sorted.size(); ++i)
+		{
+			stream.writeInt((int)sorted[i].hash);
+			stream.writeInt((int)(namesOffset + ranges[i][0]));
+			stream.writeInt((int)(recordsOffset + ranges[i][2]));
+			stream.writeShort((short)ranges[i][1]);
+			stream.writeShort((short)ranges[i][3]);
+		}
+
+		stream.write(names.getData(), names.getDataSize());
+		return stream.write(records.getData(), records.getDataSize());
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "StyleTable.h"
+#include <memory>
+#include <vector>
+
+namespace BeatCrafter
+{
+	// Read-only, memory-mapped collection of named StyleDefinitions.
+	//
+	// Layout (little-endian):
+	//   header   "BCSP", uint32 version, uint32 numStyles, uint32 indexOffset
+	//   index    numStyles x { uint32 nameHash, uint32 nameOffset, uint32 recordOffset,
+	//                          uint16 nameLength, uint16 recordLength }, sorted by nameHash
+	//   names    UTF-8, not terminated
+	//   records  encoded StyleDefinitions, see StylePack.cpp
+	//
+	// Opening a pack only maps the file and checks the header and index;
+	// records are decoded and validated when a style is looked up.
+	class StylePack
+	{
+	public:
+		struct Entry
+		{
+			juce::String name;
+			StyleTable::StyleDefinition definition;
+		};
+
+		static constexpr juce::uint32 formatVersion = 1;
+		static constexpr const char* fileExtension = ".bcstyles";
+
+		static std::unique_ptr<StylePack> open(const juce::File& file);
+		static bool write(const std::vector<Entry>& styles, juce::OutputStream& stream);
+
+		int getNumStyles() const { return numStyles; }
+		juce::String getName(int index) const;
+		int indexOf(const juce::String& name) const;
+		bool load(int index, StyleTable::StyleDefinition& definition) const;
+
+		// Case-insensitive FNV-1a over the UTF-8 name.
+		static juce::uint32 hashName(const juce::String& name);
+
+	private:
+		static constexpr size_t headerSize = 16;
+		static constexpr size_t indexEntrySize = 16;
+
+		StylePack(std::unique_ptr<juce::MemoryMappedFile> mappedFile, int numStyles, size_t indexOffset);
+
+		const juce::uint8* getIndexEntry(int index) const { return data + indexOffset + (size_t)index * indexEntrySize; }
+
+		std::unique_ptr<juce::MemoryMappedFile> file;
+		const juce::uint8* data = nullptr;
+		int numStyles = 0;
+		size_t indexOffset = 0;
+	};
+}
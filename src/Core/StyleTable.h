@@ -0,0 +1,292 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include "MidiConstants.h"
+
+namespace BeatCrafter
+{
+	// Declarative description of a drum style on the 16-step template bar.
+	// Each style is a constexpr StyleDefinition (see Styles/*.h) executed by
+	// StyleManager's interpreter. Rules run in table order and each rule walks
+	// its steps in ascending order, so RandomState draws happen in a fixed,
+	// documented sequence.
+	namespace StyleTable
+	{
+		constexpr int templateSteps = 16;
+		constexpr int maxHitsPerRule = 5;
+		constexpr int maxRulesPerSection = 5;
+		constexpr int maxBands = 5;
+
+		enum Track : uint8_t
+		{
+			Kick,
+			Snare,
+			HiHat,
+			OpenHiHat,
+			Crash,
+			Ride,
+			TomHigh,
+			TomLow,
+			RideBell,
+			HiHatPedal,
+			Splash,
+			China,
+			numTracks
+		};
+
+		using StepMask = uint16_t;
+		using TrackMask = uint16_t;
+
+		constexpr StepMask allSteps = 0xffff;
+
+		constexpr StepMask steps(std::initializer_list<int> indices)
+		{
+			StepMask mask = 0;
+			for (int index : indices)
+				mask = static_cast<StepMask>(mask | (1u << index));
+			return mask;
+		}
+
+		constexpr StepMask every(int stride, int offset = 0)
+		{
+			StepMask mask = 0;
+			for (int index = offset; index < templateSteps; index += stride)
+				mask = static_cast<StepMask>(mask | (1u << index));
+			return mask;
+		}
+
+		constexpr TrackMask tracks(std::initializer_list<Track> list)
+		{
+			TrackMask mask = 0;
+			for (auto track : list)
+				mask = static_cast<TrackMask>(mask | (1u << track));
+			return mask;
+		}
+
+		// Probability of the form base + intensity * perIntensity; unset when both are zero.
+		struct Chance
+		{
+			float base = 0.0f;
+			float perIntensity = 0.0f;
+
+			constexpr bool isSet() const { return base != 0.0f || perIntensity != 0.0f; }
+			float evaluate(float intensity) const { return base + intensity * perIntensity; }
+		};
+
+		constexpr Chance chance(float probability) { return { probability, 0.0f }; }
+		constexpr Chance scaledChance(float perIntensity) { return { 0.0f, perIntensity }; }
+
+		enum class VelocityMode : uint8_t
+		{
+			Fixed,
+			Random,
+			RandomPercent
+		};
+
+		// Fixed: min. Random: nextFloat(min, max). RandomPercent: min + nextInt(max) / 100.
+		struct Velocity
+		{
+			VelocityMode mode = VelocityMode::Fixed;
+			float min = 0.0f;
+			float max = 0.0f;
+		};
+
+		constexpr Velocity fixed(float value) { return { VelocityMode::Fixed, value, value }; }
+		constexpr Velocity random(float min, float max) { return { VelocityMode::Random, min, max }; }
+		constexpr Velocity randomPercent(float base, int range) { return { VelocityMode::RandomPercent, base, (float)range }; }
+
+		constexpr float keepProbability = -1.0f;
+		constexpr float keepSwing = -1.0f;
+
+		struct Hit
+		{
+			uint8_t track = 0;
+			StepMask steps = 0;
+			Velocity velocity;
+			float probability = keepProbability;
+			Chance chance;
+		};
+
+		constexpr Hit hit(Track track, StepMask mask, Velocity velocity,
+			float probability = keepProbability, Chance gate = {})
+		{
+			return { track, mask, velocity, probability, gate };
+		}
+
+		constexpr Hit hit(Track track, StepMask mask, Velocity velocity, Chance gate)
+		{
+			return { track, mask, velocity, keepProbability, gate };
+		}
+
+		enum class RuleKind : uint8_t
+		{
+			None,
+			EachHit,
+			FirstMatch,
+			GhostNotes
+		};
+
+		enum class RuleGate : uint8_t
+		{
+			Always,
+			Chance,
+			Otherwise
+		};
+
+		// EachHit fires every hit covering the step; FirstMatch fires only the
+		// first whose mask and chance pass (an if/else-if chain). Otherwise runs
+		// when the closest preceding Chance gate failed.
+		struct Rule
+		{
+			RuleKind kind = RuleKind::None;
+			RuleGate gate = RuleGate::Always;
+			Chance gateChance;
+			Chance stepChance;
+			std::array<Hit, maxHitsPerRule> hits{};
+
+			constexpr StepMask getStepMask() const
+			{
+				StepMask mask = 0;
+				for (const auto& h : hits)
+					mask = static_cast<StepMask>(mask | h.steps);
+				return mask;
+			}
+		};
+
+		constexpr Rule makeRule(RuleKind kind, std::initializer_list<Hit> list)
+		{
+			Rule rule;
+			rule.kind = kind;
+			std::size_t index = 0;
+			for (const auto& h : list)
+				rule.hits[index++] = h;
+			return rule;
+		}
+
+		constexpr Rule each(std::initializer_list<Hit> list) { return makeRule(RuleKind::EachHit, list); }
+		constexpr Rule firstMatch(std::initializer_list<Hit> list) { return makeRule(RuleKind::FirstMatch, list); }
+
+		constexpr Rule ghostNotes(Track track, Chance probability)
+		{
+			Rule rule;
+			rule.kind = RuleKind::GhostNotes;
+			rule.stepChance = probability;
+			rule.hits[0].track = track;
+			return rule;
+		}
+
+		constexpr Rule when(Chance gate, Rule rule)
+		{
+			rule.gate = RuleGate::Chance;
+			rule.gateChance = gate;
+			return rule;
+		}
+
+		constexpr Rule otherwise(Rule rule)
+		{
+			rule.gate = RuleGate::Otherwise;
+			return rule;
+		}
+
+		constexpr Rule perStep(Chance gate, Rule rule)
+		{
+			rule.stepChance = gate;
+			return rule;
+		}
+
+		struct Section
+		{
+			std::array<Rule, maxRulesPerSection> rules{};
+		};
+
+		constexpr Section section(std::initializer_list<Rule> list)
+		{
+			Section result;
+			std::size_t index = 0;
+			for (const auto& rule : list)
+				result.rules[index++] = rule;
+			return result;
+		}
+
+		struct Band
+		{
+			float maxIntensity = 1.0f;
+			Section section;
+		};
+
+		// Picks the first band with intensity <= maxIntensity, the last band otherwise.
+		struct BandedSection
+		{
+			TrackMask clearTracks = 0;
+			int numBands = 0;
+			std::array<Band, maxBands> bands{};
+		};
+
+		constexpr BandedSection banded(TrackMask clearTracks, std::initializer_list<Band> list)
+		{
+			BandedSection result;
+			result.clearTracks = clearTracks;
+			for (const auto& band : list)
+				result.bands[(std::size_t)result.numBands++] = band;
+			return result;
+		}
+
+		// family picks the built-in behaviours that are still code rather than
+		// table (soft intro, subtle variations, complexity), so a pack style
+		// declares which built-in style it extends.
+		struct StyleDefinition
+		{
+			StyleType family = StyleType::Rock;
+			float swing = keepSwing;
+			Section pattern;
+			BandedSection snare;
+			BandedSection hiHat;
+			Section breakFill;
+		};
+
+		constexpr bool isValid(const Rule& rule)
+		{
+			for (const auto& h : rule.hits)
+			{
+				if (h.track >= numTracks)
+					return false;
+				if (h.velocity.mode == VelocityMode::Random && h.velocity.min > h.velocity.max)
+					return false;
+				if (h.velocity.mode == VelocityMode::RandomPercent && !(h.velocity.max >= 0.0f && h.velocity.max <= 100.0f))
+					return false;
+			}
+			return rule.kind == RuleKind::None || rule.kind == RuleKind::GhostNotes || rule.getStepMask() != 0;
+		}
+
+		constexpr bool isValid(const Section& s)
+		{
+			for (const auto& rule : s.rules)
+				if (!isValid(rule))
+					return false;
+			return true;
+		}
+
+		constexpr bool isValid(const BandedSection& s)
+		{
+			if (s.numBands <= 0 || s.numBands > maxBands)
+				return false;
+			for (int i = 0; i < s.numBands; ++i)
+			{
+				if (i > 0 && s.bands[(std::size_t)i].maxIntensity <= s.bands[(std::size_t)i - 1].maxIntensity)
+					return false;
+				if (!isValid(s.bands[(std::size_t)i].section))
+					return false;
+			}
+			return true;
+		}
+
+		constexpr bool isValid(const StyleDefinition& style)
+		{
+			return style.family >= StyleType::Rock && style.family <= StyleType::Punk
+				&& (style.swing == keepSwing || (style.swing >= 0.0f && style.swing <= 1.0f))
+				&& isValid(style.pattern) && isValid(style.snare) && isValid(style.hiHat) && isValid(style.breakFill);
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition electronicStyle = {
+		StyleType::Electronic,
+		keepSwing,
+		section({
+			each({ hit(Kick, every(4), fixed(0.9f)) }),
+			each({ hit(Snare, steps({ 4, 12 }), fixed(0.7f)) }),
+			each({ hit(HiHat, every(4, 2), fixed(0.4f)) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.4f, section({ each({ hit(Snare, steps({ 8 }), fixed(0.8f)) }) }) },
+			{ 0.6f, section({ each({ hit(Snare, steps({ 4, 12 }), fixed(0.8f)) }) }) },
+			{ 0.8f, section({ each({
+				hit(Snare, steps({ 4 }), fixed(0.9f)),
+				hit(Snare, steps({ 10 }), fixed(0.7f)),
+				hit(Snare, steps({ 12 }), fixed(0.8f)) }) }) },
+			{ 1.0f, section({ each({
+				hit(Snare, every(2), random(0.85f, 0.95f)),
+				hit(Kick, every(2), random(0.9f, 1.0f)) }) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, Crash, Splash }), {
+			{ 0.5f, section({ firstMatch({
+				hit(HiHat, every(4), fixed(0.3f + 0.2f)),
+				hit(HiHat, allSteps, fixed(0.3f + 0.0f)) }) }) },
+			{ 0.7f, section({ firstMatch({
+				hit(OpenHiHat, steps({ 2, 10 }), random(0.5f, 0.7f)),
+				hit(HiHat, every(4), fixed(0.3f + 0.2f)),
+				hit(HiHat, allSteps, fixed(0.3f + 0.0f)) }) }) },
+			{ 0.8f, section({ firstMatch({
+				hit(Splash, steps({ 0, 8 }), random(0.7f, 0.9f)),
+				hit(OpenHiHat, steps({ 2, 10 }), random(0.5f, 0.7f)),
+				hit(HiHat, every(4), fixed(0.3f + 0.2f)),
+				hit(HiHat, allSteps, fixed(0.3f + 0.0f)) }) }) },
+			{ 1.0f, section({
+				when(chance(0.6f), each({ hit(OpenHiHat, every(2), random(0.7f, 0.9f)) })),
+				otherwise(each({ hit(Crash, every(2), random(0.8f, 1.0f)) })),
+				when(chance(0.4f), each({ hit(Splash, steps({ 4, 12 }), random(0.8f, 0.95f)) })) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0, 8 }), fixed(0.9f)),
+				hit(Kick, steps({ 4, 12 }), fixed(0.85f)) }),
+			each({
+				hit(TomHigh, steps({ 2, 6, 10 }), fixed(0.6f + 0.0f)),
+				hit(TomHigh, steps({ 14 }), fixed(0.6f + 0.2f)) }),
+			each({
+				hit(TomLow, steps({ 1, 9 }), fixed(0.6f + 0.0f)),
+				hit(TomLow, steps({ 5, 13 }), fixed(0.6f + 0.1f)) }),
+			each({
+				hit(Splash, steps({ 0 }), fixed(0.8f)),
+				hit(Splash, steps({ 8 }), fixed(0.7f)) }),
+		}),
+	};
+
+	static_assert(isValid(electronicStyle), "Electronic style table is malformed");
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition funkStyle = {
+		StyleType::Funk,
+		keepSwing,
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.9f)),
+				hit(Kick, steps({ 6 }), fixed(0.6f), 0.75f) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.85f)) }),
+			each({
+				hit(HiHat, steps({ 4 }), fixed(0.5f)),
+				hit(HiHat, steps({ 12 }), fixed(0.4f), 0.8f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.3f, section({
+				each({ hit(Snare, steps({ 8 }), fixed(0.9f)) }),
+				ghostNotes(Snare, chance(0.5f)) }) },
+			{ 0.6f, section({
+				each({
+					hit(Snare, steps({ 4 }), fixed(0.9f)),
+					hit(Snare, steps({ 12 }), fixed(0.85f)) }),
+				ghostNotes(Snare, scaledChance(0.8f)) }) },
+			{ 1.0f, section({
+				each({
+					hit(Snare, steps({ 4 }), fixed(0.9f)),
+					hit(Snare, steps({ 6 }), fixed(0.3f)),
+					hit(Snare, steps({ 12 }), fixed(0.85f)),
+					hit(Snare, steps({ 15 }), fixed(0.4f)) }),
+				ghostNotes(Snare, scaledChance(0.9f)) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, HiHatPedal, Splash }), {
+			{ 0.5f, section({ firstMatch({
+				hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)),
+				hit(HiHat, allSteps, random(0.4f, 0.7f)) }) }) },
+			{ 0.7f, section({
+				firstMatch({
+					hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)),
+					hit(HiHat, allSteps, random(0.4f, 0.7f)) }),
+				each({ hit(HiHatPedal, every(4, 1), fixed(0.4f)) }) }) },
+			{ 1.0f, section({
+				firstMatch({
+					hit(Splash, steps({ 14 }), random(0.6f, 0.8f), chance(0.6f)),
+					hit(OpenHiHat, steps({ 6 }), random(0.6f, 0.8f)),
+					hit(HiHat, allSteps, random(0.4f, 0.7f)) }),
+				each({ hit(HiHatPedal, every(4, 1), fixed(0.4f)) }) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.9f)),
+				hit(Kick, steps({ 3 }), fixed(0.7f)),
+				hit(Kick, steps({ 7 }), fixed(0.6f)),
+				hit(Kick, steps({ 10 }), fixed(0.8f)) }),
+			each({ hit(TomHigh, steps({ 1, 4, 6, 12, 14 }), random(0.6f, 0.9f)) }),
+			each({ hit(TomLow, steps({ 2, 8, 15 }), random(0.6f, 0.9f)) }),
+			each({
+				hit(Splash, steps({ 0 }), random(0.7f, 0.9f)),
+				hit(Splash, steps({ 8 }), random(0.6f, 0.8f)) }),
+		}),
+	};
+
+	static_assert(isValid(funkStyle), "Funk style table is malformed");
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StepMask hipHopHats = every(2, 1) | every(4, 2);
+
+	inline constexpr StyleDefinition hipHopStyle = {
+		StyleType::HipHop,
+		keepSwing,
+		section({
+			each({ hit(Kick, steps({ 0 }), fixed(0.95f)) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.9f)) }),
+			each({
+				hit(HiHat, steps({ 4 }), fixed(0.45f)),
+				hit(HiHat, steps({ 12 }), fixed(0.35f), 0.6f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.4f, section({ each({ hit(Snare, steps({ 8 }), fixed(0.9f)) }) }) },
+			{ 0.6f, section({ each({ hit(Snare, steps({ 4, 12 }), fixed(0.9f)) }) }) },
+			{ 0.8f, section({
+				each({ hit(Snare, steps({ 4, 12 }), fixed(0.9f)) }),
+				ghostNotes(Snare, scaledChance(0.7f)) }) },
+			{ 1.0f, section({ each({
+				hit(Snare, steps({ 4, 12 }), fixed(1.0f)),
+				hit(Snare, steps({ 6, 14 }), fixed(0.8f)) }) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, HiHatPedal, Splash }), {
+			{ 0.4f, section({ each({ hit(HiHat, every(4, 2), random(0.4f, 0.6f)) }) }) },
+			{ 0.6f, section({
+				each({ hit(HiHat, every(4, 2), random(0.4f, 0.6f)) }),
+				each({ hit(HiHat, every(4, 1), random(0.3f, 0.5f)) }) }) },
+			{ 0.8f, section({
+				firstMatch({
+					hit(OpenHiHat, steps({ 3, 11 }), random(0.5f, 0.7f)),
+					hit(HiHat, hipHopHats, random(0.3f, 0.5f)) }),
+				each({ hit(HiHatPedal, steps({ 6, 14 }), fixed(0.3f)) }) }) },
+			{ 1.0f, section({
+				firstMatch({
+					hit(Splash, steps({ 0 }), random(0.6f, 0.8f), chance(0.5f)),
+					hit(OpenHiHat, steps({ 3, 11 }), random(0.5f, 0.7f)),
+					hit(HiHat, hipHopHats, random(0.3f, 0.5f)) }),
+				each({ hit(HiHatPedal, steps({ 6, 14 }), fixed(0.3f)) }) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.95f)),
+				hit(Kick, steps({ 7 }), fixed(0.6f)),
+				hit(Kick, steps({ 11 }), fixed(0.7f)) }),
+			each({ hit(TomHigh, steps({ 2, 4, 6, 12, 14 }), random(0.6f, 0.9f)) }),
+			each({ hit(TomLow, steps({ 1, 8, 15 }), random(0.6f, 0.9f)) }),
+			each({ hit(Splash, steps({ 0 }), random(0.7f, 0.9f)) }),
+		}),
+	};
+
+	static_assert(isValid(hipHopStyle), "Hip-hop style table is malformed");
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition jazzStyle = {
+		StyleType::Jazz,
+		0.67f,
+		section({
+			each({ hit(Kick, steps({ 0 }), randomPercent(0.4f, 20)) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.55f)) }),
+			each({
+				hit(Ride, steps({ 2 }), fixed(0.3f)),
+				hit(Ride, steps({ 10 }), fixed(0.35f), 0.7f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.4f, section({
+				each({ hit(Snare, steps({ 8 }), random(0.5f, 0.7f)) }),
+				ghostNotes(Snare, scaledChance(0.6f)) }) },
+			{ 0.7f, section({
+				each({ hit(Snare, steps({ 4, 12 }), random(0.5f, 0.7f)) }),
+				ghostNotes(Snare, scaledChance(0.8f)) }) },
+			{ 1.0f, section({ perStep(scaledChance(0.4f),
+				each({ hit(Snare, every(1, 1), random(0.3f, 0.8f)) })) }) },
+		}),
+		banded(tracks({ Ride, RideBell, HiHatPedal, OpenHiHat, Splash }), {
+			{ 0.5f, section({
+				each({ hit(Ride, every(2), random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, steps({ 2, 10 }), fixed(0.3f)) }) }) },
+			{ 0.7f, section({
+				firstMatch({
+					hit(RideBell, steps({ 4, 12 }), random(0.6f, 0.8f)),
+					hit(Ride, every(2), random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, every(4, 2), random(0.3f, 0.45f)) }) }) },
+			{ 1.0f, section({
+				firstMatch({
+					hit(Splash, steps({ 8 }), random(0.5f, 0.7f), chance(0.5f)),
+					hit(RideBell, every(4), random(0.6f, 0.8f), chance(0.4f)),
+					hit(OpenHiHat, steps({ 6 }), random(0.4f, 0.6f), chance(0.3f)),
+					hit(Ride, allSteps, random(0.4f, 0.6f), chance(0.8f)) }),
+				each({ hit(HiHatPedal, every(4, 2), random(0.3f, 0.5f)) }) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.6f)),
+				hit(Kick, steps({ 6 }), fixed(0.5f)),
+				hit(Kick, steps({ 10 }), fixed(0.55f)) }),
+			each({
+				hit(TomHigh, steps({ 1, 7, 13 }), random(0.6f - 0.1f, 0.6f + 0.1f)),
+				hit(TomHigh, steps({ 3 }), random(0.5f - 0.1f, 0.5f + 0.1f)),
+				hit(TomHigh, steps({ 11 }), random(0.7f - 0.1f, 0.7f + 0.1f)) }),
+			each({
+				hit(TomLow, steps({ 5, 15 }), random(0.7f - 0.1f, 0.7f + 0.1f)),
+				hit(TomLow, steps({ 9 }), random(0.6f - 0.1f, 0.6f + 0.1f)) }),
+			each({ hit(Splash, steps({ 0 }), random(0.6f, 0.8f)) }),
+		}),
+	};
+
+	static_assert(isValid(jazzStyle), "Jazz style table is malformed");
+}
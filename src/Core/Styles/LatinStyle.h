@@ -0,0 +1,57 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition latinStyle = {
+		StyleType::Latin,
+		keepSwing,
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.75f)),
+				hit(Kick, steps({ 6 }), fixed(0.5f), 0.8f) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.8f)) }),
+			each({
+				hit(OpenHiHat, steps({ 4 }), fixed(0.55f)),
+				hit(OpenHiHat, steps({ 12 }), fixed(0.5f), 0.75f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.4f, section({ each({ hit(Snare, steps({ 8 }), fixed(0.8f)) }) }) },
+			{ 0.7f, section({ each({ hit(Snare, steps({ 4, 12 }), fixed(0.7f)) }) }) },
+			{ 1.0f, section({ each({
+				hit(Snare, steps({ 4, 12 }), fixed(0.8f)),
+				hit(Snare, steps({ 6, 14 }), fixed(0.6f)) }) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, Ride, HiHatPedal, Splash }), {
+			{ 0.5f, section({ firstMatch({
+				hit(OpenHiHat, every(4, 2), random(0.5f, 0.7f)),
+				hit(HiHat, every(2), random(0.4f, 0.6f)) }) }) },
+			{ 0.7f, section({
+				firstMatch({
+					hit(OpenHiHat, every(4, 2), random(0.5f, 0.7f)),
+					hit(HiHat, every(2), random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, steps({ 3, 7, 11 }), fixed(0.4f)) }) }) },
+			{ 0.8f, section({
+				firstMatch({
+					hit(Splash, steps({ 8 }), random(0.6f, 0.8f), chance(0.6f)),
+					hit(OpenHiHat, every(4, 2), random(0.5f, 0.7f)),
+					hit(HiHat, every(2), random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, steps({ 3, 7, 11 }), fixed(0.4f)) }) }) },
+			{ 1.0f, section({
+				firstMatch({
+					hit(Ride, every(4), random(0.4f, 0.6f)),
+					hit(OpenHiHat, every(4, 2), random(0.5f, 0.7f)) }),
+				each({ hit(HiHatPedal, steps({ 3, 7, 11 }), fixed(0.4f)) }) }) },
+		}),
+		section({
+			each({ hit(Kick, steps({ 0, 3, 6, 10 }), random(0.7f, 0.85f)) }),
+			each({ hit(TomHigh, steps({ 1, 4, 8, 12, 14 }), random(0.6f, 0.9f)) }),
+			each({ hit(TomLow, steps({ 2, 5, 9, 15 }), random(0.6f, 0.9f)) }),
+			each({
+				hit(Splash, steps({ 0 }), random(0.7f, 0.9f)),
+				hit(Splash, steps({ 8 }), random(0.6f, 0.8f)) }),
+		}),
+	};
+
+	static_assert(isValid(latinStyle), "Latin style table is malformed");
+}
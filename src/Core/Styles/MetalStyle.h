@@ -0,0 +1,57 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition metalStyle = {
+		StyleType::Metal,
+		keepSwing,
+		section({
+			each({
+				hit(Kick, steps({ 0 }), fixed(0.95f)),
+				hit(Kick, steps({ 2 }), fixed(0.7f), 0.8f) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.95f)) }),
+			each({ hit(Ride, steps({ 6 }), fixed(0.5f), 0.7f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.3f, section({ each({ hit(Snare, steps({ 8 }), random(0.9f, 1.0f)) }) }) },
+			{ 0.5f, section({ each({ hit(Snare, steps({ 4, 12 }), random(0.85f, 0.95f)) }) }) },
+			{ 0.7f, section({ each({
+				hit(Snare, steps({ 4, 12 }), random(0.9f, 1.0f)),
+				hit(Snare, steps({ 5, 13 }), random(0.7f, 0.8f)) }) }) },
+			{ 0.85f, section({ each({ hit(Snare, every(2, 2), random(0.8f, 0.95f)) }) }) },
+			{ 1.0f, section({ each({ hit(Snare, every(2, 1), random(0.85f, 1.0f)) }) }) },
+		}),
+		banded(tracks({ Ride, RideBell, HiHatPedal, Splash, China }), {
+			{ 0.4f, section({ each({ hit(Ride, every(2), random(0.5f, 0.7f)) }) }) },
+			{ 0.6f, section({ firstMatch({
+				hit(RideBell, steps({ 0, 8 }), random(0.7f, 0.9f), chance(0.5f)),
+				hit(Ride, every(2), random(0.5f, 0.7f)) }) }) },
+			{ 0.8f, section({
+				firstMatch({
+					hit(China, steps({ 0 }), random(0.8f, 1.0f), chance(0.5f)),
+					hit(RideBell, every(4), random(0.7f, 0.9f), chance(0.4f)),
+					hit(Ride, allSteps, random(0.5f, 0.7f)) }),
+				each({ hit(HiHatPedal, steps({ 4, 12 }), fixed(0.3f)) }) }) },
+			{ 1.0f, section({ perStep(chance(0.7f), firstMatch({
+				hit(China, allSteps, random(0.8f, 1.0f), chance(0.6f)),
+				hit(Splash, allSteps, random(0.7f, 0.9f)) })) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0, 8 }), fixed(0.95f)),
+				hit(Kick, steps({ 1, 4, 9, 12 }), fixed(0.9f)),
+				hit(Kick, steps({ 2, 5, 13 }), fixed(0.85f)) }),
+			each({
+				hit(TomHigh, steps({ 3, 10, 14 }), random(0.8f, 0.95f)),
+				hit(TomHigh, steps({ 6 }), random(0.7f, 0.9f)) }),
+			each({
+				hit(TomLow, steps({ 7, 15 }), random(0.8f, 0.95f)),
+				hit(TomLow, steps({ 11 }), random(0.7f, 0.9f)) }),
+			each({ hit(China, steps({ 0 }), random(0.9f, 1.0f)) }),
+			each({ hit(Splash, steps({ 8 }), random(0.8f, 0.95f)) }),
+		}),
+	};
+
+	static_assert(isValid(metalStyle), "Metal style table is malformed");
+}
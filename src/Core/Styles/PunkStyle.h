@@ -0,0 +1,46 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition punkStyle = {
+		StyleType::Punk,
+		keepSwing,
+		section({
+			each({ hit(Kick, steps({ 0 }), fixed(0.9f)) }),
+			each({ hit(Snare, steps({ 8 }), fixed(1.0f)) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.4f, section({ each({ hit(Snare, steps({ 4, 12 }), random(0.8f, 0.95f)) }) }) },
+			{ 0.7f, section({ each({ hit(Snare, every(4, 2), random(0.85f, 0.95f)) }) }) },
+			{ 1.0f, section({
+				each({ hit(Snare, every(4, 2), random(0.9f, 1.0f)) }),
+				when(scaledChance(0.3f), each({ hit(Snare, steps({ 1 }), random(0.3f, 0.5f), 0.6f) })),
+				when(scaledChance(0.3f), each({ hit(Snare, steps({ 9 }), random(0.3f, 0.5f), 0.6f) })) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, Crash, Splash }), {
+			{ 0.4f, section({ each({ hit(HiHat, every(2), random(0.5f, 0.7f)) }) }) },
+			{ 0.5f, section({
+				each({ hit(HiHat, allSteps, random(0.5f, 0.7f)) }),
+				each({ hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)) }) }) },
+			{ 0.6f, section({ each({ hit(OpenHiHat, allSteps, random(0.5f, 0.8f)) }) }) },
+			{ 0.7f, section({
+				each({ hit(OpenHiHat, allSteps, random(0.5f, 0.8f)) }),
+				each({ hit(Splash, every(4, 2), random(0.85f, 0.95f)) }) }) },
+			{ 1.0f, section({
+				each({ hit(Crash, every(4), random(0.85f, 0.95f)) }),
+				each({ hit(Splash, every(4, 2), random(0.85f, 0.95f)) }) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0, 8 }), fixed(0.9f)),
+				hit(Kick, steps({ 4, 12 }), fixed(0.85f)) }),
+			each({ hit(TomHigh, every(4, 2), random(0.7f, 0.95f)) }),
+			each({ hit(TomLow, every(4, 1), random(0.6f, 0.9f)) }),
+			each({ hit(China, steps({ 0 }), random(0.8f, 1.0f)) }),
+			each({ hit(Splash, steps({ 8 }), random(0.7f, 0.9f)) }),
+		}),
+	};
+
+	static_assert(isValid(punkStyle), "Punk style table is malformed");
+}
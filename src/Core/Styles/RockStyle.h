@@ -0,0 +1,60 @@
+#pragma once
+#include "../StyleTable.h"
+
+namespace BeatCrafter::StyleTable
+{
+	inline constexpr StyleDefinition rockStyle = {
+		StyleType::Rock,
+		keepSwing,
+		section({
+			each({ hit(Kick, steps({ 0 }), randomPercent(0.85f, 15)) }),
+			each({ hit(Snare, steps({ 8 }), fixed(0.9f)) }),
+			each({ hit(HiHat, steps({ 4 }), fixed(0.4f), 0.7f) }),
+		}),
+		banded(tracks({ Snare }), {
+			{ 0.3f, section({ each({ hit(Snare, steps({ 8 }), random(0.8f, 0.9f)) }) }) },
+			{ 0.5f, section({ each({ hit(Snare, steps({ 4, 10 }), random(0.7f, 0.85f)) }) }) },
+			{ 0.7f, section({ each({ hit(Snare, steps({ 4, 12 }), random(0.8f, 0.9f)) }) }) },
+			{ 0.85f, section({ each({
+				hit(Snare, steps({ 4, 12 }), random(0.8f, 0.9f)),
+				hit(Snare, steps({ 6, 14 }), random(0.6f, 0.8f)) }) }) },
+			{ 1.0f, section({ each({ hit(Snare, every(2, 2), random(0.7f, 0.9f), chance(0.8f)) }) }) },
+		}),
+		banded(tracks({ HiHat, OpenHiHat, HiHatPedal, Splash, China }), {
+			{ 0.4f, section({ each({ hit(HiHat, every(2), random(0.5f, 0.7f)) }) }) },
+			{ 0.6f, section({ firstMatch({
+				hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)),
+				hit(HiHat, every(2), random(0.5f, 0.7f)) }) }) },
+			{ 0.8f, section({
+				firstMatch({
+					hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)),
+					hit(HiHat, allSteps, random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, steps({ 2, 10 }), fixed(0.4f)) }) }) },
+			{ 1.0f, section({
+				firstMatch({
+					hit(Splash, steps({ 0 }), random(0.7f, 0.9f), chance(0.6f)),
+					hit(China, steps({ 8 }), random(0.7f, 0.9f), chance(0.4f)),
+					hit(OpenHiHat, steps({ 6, 14 }), random(0.6f, 0.8f)),
+					hit(HiHat, allSteps, random(0.4f, 0.6f)) }),
+				each({ hit(HiHatPedal, steps({ 2, 10 }), fixed(0.4f)) }) }) },
+		}),
+		section({
+			each({
+				hit(Kick, steps({ 0, 8 }), fixed(0.9f)),
+				hit(Kick, steps({ 4 }), fixed(0.85f)),
+				hit(Kick, steps({ 12 }), fixed(0.8f)) }),
+			each({
+				hit(TomHigh, steps({ 2, 10 }), random(0.7f, 0.9f)),
+				hit(TomHigh, steps({ 6 }), random(0.6f, 0.8f)),
+				hit(TomHigh, steps({ 14 }), random(0.8f, 0.95f)) }),
+			each({
+				hit(TomLow, steps({ 1 }), random(0.6f, 0.8f)),
+				hit(TomLow, steps({ 5, 13 }), random(0.7f, 0.9f)) }),
+			each({
+				hit(Splash, steps({ 0 }), random(0.8f, 1.0f)),
+				hit(Splash, steps({ 8 }), random(0.7f, 0.9f)) }),
+		}),
+	};
+
+	static_assert(isValid(rockStyle), "Rock style table is malformed");
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <array>
+#include <atomic>
+
+namespace BeatCrafter
+{
+	template <typename T>
+	class TripleBuffer
+	{
+	public:
+		T& getWriteBuffer() { return buffers[(size_t)writeIndex]; }
+
+		void publish()
+		{
+			writeIndex = middleIndex.exchange(writeIndex | freshFlag, std::memory_order_acq_rel) & indexMask;
+		}
+
+		bool update()
+		{
+			if ((middleIndex.load(std::memory_order_acquire) & freshFlag) == 0)
+				return false;
+
+			readIndex = middleIndex.exchange(readIndex, std::memory_order_acq_rel) & indexMask;
+			return true;
+		}
+
+		const T& getReadBuffer() const { return buffers[(size_t)readIndex]; }
+
+	private:
+		static constexpr int indexMask = 3;
+		static constexpr int freshFlag = 4;
+
+		std::array<T, 3> buffers;
+		int writeIndex = 0;
+		int readIndex = 1;
+		std::atomic<int> middleIndex{ 2 };
+	};
+}
@@ -4,6 +4,8 @@ namespace BeatCrafter {
 
 	PatternGrid::PatternGrid() {
 		lookAndFeel = dynamic_cast<ModernLookAndFeel*>(&getLookAndFeel());
+		setTooltip("Cmd/Ctrl-drag to export this pattern as MIDI, add Shift for a "
+			+ juce::String(evolvingExportBars) + "-bar version that builds up to full intensity");
 		startTimerHz(30);
 	}
 
@@ -11,14 +13,24 @@ namespace BeatCrafter {
 		stopTimer();
 	}
 
-	void PatternGrid::setPattern(const Pattern* pattern) {
-		currentPattern = pattern;
-		bufferDirty = true;
-		repaint();
-	}
-
 	void PatternGrid::setPatternEngine(PatternEngine* engine) {
 		patternEngine = engine;
+		if (patternEngine) {
+			patternEngine->updateDisplaySnapshot();
+			refreshFromSnapshot();
+		}
+	}
+
+	void PatternGrid::refreshFromSnapshot() {
+		const auto& snapshot = patternEngine->getDisplaySnapshot();
+		currentPattern = snapshot.rendered ? &snapshot.pattern : nullptr;
+		playheadPosition = snapshot.playhead;
+		if (currentPattern && currentPattern->getLength() != displayedLength) {
+			displayedLength = currentPattern->getLength();
+			resized();
+		}
+		bufferDirty = true;
+		repaint();
 	}
 
 	void PatternGrid::paint(juce::Graphics& g)
@@ -77,16 +89,172 @@ namespace BeatCrafter {
 	}
 
 	void PatternGrid::timerCallback() {
-		if (patternEngine) {
-			int newPlayhead = patternEngine->getCurrentStep();
-			if (newPlayhead != playheadPosition) {
-				playheadPosition = newPlayhead;
-				bufferDirty = true;
-				repaint();
+		if (!patternEngine)
+			return;
+
+		if (patternEngine->updateDisplaySnapshot())
+			refreshFromSnapshot();
+
+		const auto& snapshot = patternEngine->getDisplaySnapshot();
+		if (snapshot.rendered && snapshot.patternVersion != requestedExportVersion && isMouseOver(true))
+			requestExport();
+	}
+
+	void PatternGrid::mouseDrag(const juce::MouseEvent& e) {
+		if (isDraggingExport || !patternEngine || !e.mods.isCommandDown() || e.getDistanceFromDragStart() < 4)
+			return;
+
+		// Holding the render lock keeps the export thread from replacing the files while one is picked.
+		const juce::ScopedLock rl(renderLock);
+		juce::File file;
+		{
+			const juce::ScopedLock sl(exportLock);
+			file = e.mods.isShiftDown() ? evolvingExportFile : loopExportFile;
+			if (exportedVersion != patternEngine->getDisplaySnapshot().patternVersion)
+				file = juce::File();
+		}
+
+		if (!file.existsAsFile()) {
+			auto request = createExportRequest();
+			if (!request)
+				return;
+			renderExport(*request);
+
+			const juce::ScopedLock sl(exportLock);
+			file = e.mods.isShiftDown() ? evolvingExportFile : loopExportFile;
+		}
+
+		if (!file.existsAsFile())
+			return;
+
+		{
+			const juce::ScopedLock sl(exportLock);
+			draggedExportFile = file;
+		}
+
+		isDraggingExport = true;
+		juce::DragAndDropContainer::performExternalDragDropOfFiles(
+			{ file.getFullPathName() }, false, this,
+			[safeThis = juce::Component::SafePointer<PatternGrid>(this)]() {
+				if (safeThis != nullptr)
+					safeThis->isDraggingExport = false;
+			});
+	}
+
+	std::unique_ptr<PatternGrid::ExportRequest> PatternGrid::createExportRequest() {
+		const auto& snapshot = patternEngine->getDisplaySnapshot();
+		auto base = patternEngine->copySlot(snapshot.slot);
+		auto style = patternEngine->getSlotStyleDefinition(snapshot.slot);
+		if (!base || !style)
+			return nullptr;
+
+		auto request = std::make_unique<ExportRequest>();
+		request->pattern = std::move(*base);
+		request->style = std::move(style);
+		request->styleName = patternEngine->getSlotStyleName(snapshot.slot);
+		request->seed = patternEngine->getSlotSeed(snapshot.slot);
+		request->slot = snapshot.slot;
+		request->intensity = patternEngine->getIntensity();
+		request->tripletMode = getTripletMode ? getTripletMode() : false;
+		request->version = snapshot.patternVersion;
+		requestedExportVersion = snapshot.patternVersion;
+		return request;
+	}
+
+	void PatternGrid::requestExport() {
+		auto request = createExportRequest();
+		if (!request)
+			return;
+
+		{
+			const juce::ScopedLock sl(exportLock);
+			pendingExport = std::move(request);
+		}
+
+		if (!exportThread.isThreadRunning())
+			exportThread.startThread(juce::Thread::Priority::low);
+		exportThread.notify();
+	}
+
+	void PatternGrid::ExportThread::run() {
+		while (!threadShouldExit()) {
+			std::unique_ptr<ExportRequest> request;
+			{
+				const juce::ScopedLock sl(grid.exportLock);
+				request = std::move(grid.pendingExport);
+			}
+
+			if (!request) {
+				wait(-1);
+				continue;
 			}
+
+			grid.renderExport(*request);
 		}
 	}
 
+	void PatternGrid::renderExport(const ExportRequest& request) {
+		int numBars = request.pattern.getNumBars();
+		auto meter = request.pattern.getTimeSignature();
+		auto name = "BeatCrafter " + request.pattern.getName()
+			+ " " + juce::String(juce::roundToInt(request.intensity * 100.0f)) + "%";
+
+		const juce::ScopedLock rl(renderLock);
+		if (!exportEngine) {
+			exportEngine = std::make_unique<PatternEngine>();
+			exportEngine->setBackgroundRendering(false);
+		}
+		exportEngine->setSlotStyle(request.slot, request.style, request.styleName);
+		exportEngine->setSlotSeed(request.slot, request.seed);
+		exportEngine->loadPatternToSlot(std::make_unique<Pattern>(request.pattern), request.slot);
+
+		MidiRenderer::Settings settings;
+		settings.startSlot = request.slot;
+		settings.tripletMode = request.tripletMode;
+		settings.playbackSeed = request.seed;
+		settings.meter = meter;
+
+		settings.bars = numBars;
+		settings.humanize = false;
+		settings.intensityCurve = { { 0.0, request.intensity } };
+		juce::File previousLoop, previousEvolving;
+		{
+			const juce::ScopedLock sl(exportLock);
+			previousLoop = loopExportFile;
+			previousEvolving = evolvingExportFile;
+		}
+		auto loopFile = writeExportFile(*exportEngine, settings, name, previousLoop);
+
+		settings.bars = evolvingExportBars;
+		settings.humanize = true;
+		settings.intensityCurve = { { 0.0, request.intensity }, { (double)evolvingExportBars, 1.0f } };
+		auto evolvingFile = writeExportFile(*exportEngine, settings,
+			name + " " + juce::String(evolvingExportBars) + " bars", previousEvolving);
+
+		const juce::ScopedLock sl(exportLock);
+		loopExportFile = loopFile;
+		evolvingExportFile = evolvingFile;
+		exportedVersion = request.version;
+	}
+
+	juce::File PatternGrid::writeExportFile(PatternEngine& engine, const MidiRenderer::Settings& settings,
+		const juce::String& name, const juce::File& previous) {
+		auto folder = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("BeatCrafter");
+		folder.createDirectory();
+
+		{
+			const juce::ScopedLock sl(exportLock);
+			if (previous.existsAsFile() && previous != draggedExportFile)
+				previous.deleteFile();
+		}
+
+		auto file = folder.getNonexistentChildFile(juce::File::createLegalFileName(name), ".mid", false);
+		auto sequence = MidiRenderer::render(engine, settings);
+		if (!MidiRenderer::writeMidiFile(sequence, settings, file))
+			return {};
+		return file;
+	}
+
 	juce::Rectangle<float> PatternGrid::getStepBounds(int track, int step) const {
 		float x = headerWidth + step * cellWidth;
 		float y = headerHeight + track * cellHeight;
@@ -101,9 +269,11 @@ namespace BeatCrafter {
 
 		if (currentPattern) {
 			int numSteps = currentPattern->getLength();
-			g.setColour(lookAndFeel->backgroundLight.withAlpha(0.18f));
-			for (int i = 4; i < numSteps; i += 4) {
+			int stepsPerBeat = currentPattern->getStepsPerQuarter();
+			int stepsPerBar = currentPattern->getStepsPerBar();
+			for (int i = stepsPerBeat; i < numSteps; i += stepsPerBeat) {
 				float x = headerWidth + i * cellWidth;
+				g.setColour(lookAndFeel->backgroundLight.withAlpha(i % stepsPerBar == 0 ? 0.35f : 0.18f));
 				g.drawLine(x, (float)headerHeight, x, (float)getHeight(), 1.0f);
 			}
 		}
@@ -124,29 +294,23 @@ namespace BeatCrafter {
 				auto ledBounds = juce::Rectangle<float>(ledDiameter, ledDiameter)
 					.withCentre({ cx, cy });
 
-				const auto* stepObj = currentPattern->getTrack(track).getStep(step);
-
-				if (stepObj) {
-					if (stepObj->isActive()) {
-						float velocity = stepObj->getVelocity();
-						float alpha = juce::jlimit(0.f, 1.f, 0.7f + velocity * 0.3f);
-						g.setColour(lookAndFeel->stepActive.withAlpha(alpha));
-						g.fillEllipse(ledBounds);
-					}
-					else {
-						bool isDownbeat = (step % 4 == 0);
-						g.setColour(lookAndFeel->stepInactive.withAlpha(isDownbeat ? 0.75f : 0.55f));
-						g.fillEllipse(ledBounds);
-					}
+				if (currentPattern->isActive(track, step)) {
+					float velocity = currentPattern->getVelocity(track, step);
+					float alpha = juce::jlimit(0.f, 1.f, 0.7f + velocity * 0.3f);
+					g.setColour(lookAndFeel->stepActive.withAlpha(alpha));
+					g.fillEllipse(ledBounds);
+				}
+				else {
+					bool isDownbeat = (step % currentPattern->getStepsPerQuarter() == 0);
+					g.setColour(lookAndFeel->stepInactive.withAlpha(isDownbeat ? 0.75f : 0.55f));
+					g.fillEllipse(ledBounds);
 				}
 			}
 		}
 	}
 
 	void PatternGrid::drawPlayhead(juce::Graphics& g) {
-		if (!patternEngine) return;
-
-		int playheadPos = patternEngine->getCurrentStep();
+		int playheadPos = playheadPosition;
 		if (playheadPos < 0 || !currentPattern) return;
 
 		float x = headerWidth + playheadPos * cellWidth;
@@ -160,14 +324,17 @@ namespace BeatCrafter {
 	}
 
 	void PatternGrid::drawTrackLabels(juce::Graphics& g) {
-		if (!currentPattern) return;
+		if (!currentPattern || !patternEngine) return;
 
 		if (!lookAndFeel)
 			lookAndFeel = dynamic_cast<ModernLookAndFeel*>(&getLookAndFeel());
 
 		g.setFont(lookAndFeel->getPluginFont(ModernLookAndFeel::fontSizeGridLabel));
 
-		for (int i = 0; i < currentPattern->getNumTracks(); ++i) {
+		auto slotPattern = patternEngine->copySlot(patternEngine->getDisplaySnapshot().slot);
+		const Pattern labels = slotPattern ? std::move(*slotPattern) : Pattern();
+		int numLabels = juce::jmin(currentPattern->getNumTracks(), labels.getNumTracks());
+		for (int i = 0; i < numLabels; ++i) {
 			int y = headerHeight + juce::roundToInt(i * cellHeight);
 			int h = juce::roundToInt(cellHeight);
 			auto bounds = juce::Rectangle<int>(0, y, headerWidth, h);
@@ -175,7 +342,7 @@ namespace BeatCrafter {
 			g.setColour(lookAndFeel->backgroundMid);
 			g.fillRect(bounds);
 			g.setColour(lookAndFeel->textColour);
-			g.drawText(currentPattern->getTrack(i).getName(),
+			g.drawText(labels.getTrack(i).getName(),
 				bounds.reduced(4, 0),
 				juce::Justification::centredLeft);
 		}
@@ -187,10 +354,10 @@ namespace BeatCrafter {
 		g.setColour(lookAndFeel->textDimmed);
 		g.setFont(lookAndFeel->getPluginFont(ModernLookAndFeel::fontSizeStepNumberSmall));
 
-		for (int i = 0; i < currentPattern->getLength(); ++i) {
-			if (i % 4 != 0) continue;
+		int stepsPerBeat = currentPattern->getStepsPerQuarter();
+		for (int i = 0; i < currentPattern->getLength(); i += stepsPerBeat) {
 			int x = headerWidth + juce::roundToInt(i * cellWidth);
-			int w = juce::roundToInt(cellWidth * 4);
+			int w = juce::roundToInt(cellWidth * stepsPerBeat);
 			auto bounds = juce::Rectangle<int>(x, 0, w, headerHeight);
 			g.drawText(juce::String(i + 1), bounds.reduced(2, 0),
 				juce::Justification::centredLeft);
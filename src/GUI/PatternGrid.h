@@ -2,27 +2,56 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "../Core/Pattern.h"
 #include "../Core/PatternEngine.h"
+#include "../Core/MidiRenderer.h"
 #include "LookAndFeel.h"
 
 namespace BeatCrafter {
 
 	class PatternGrid : public juce::Component,
+		public juce::SettableTooltipClient,
 		public juce::Timer
 	{
 	public:
 		PatternGrid();
 		~PatternGrid() override;
 
-		void setPattern(const Pattern* pattern);
 		void setPatternEngine(PatternEngine* engine);
 
 		void paint(juce::Graphics&) override;
 		void resized() override;
 		void timerCallback() override;
+		void mouseDrag(const juce::MouseEvent& e) override;
 		void markDirty();
 
+		std::function<bool()> getTripletMode;
+
 	private:
-		const Pattern* currentPattern = nullptr;
+		static constexpr int evolvingExportBars = 16;
+
+		struct ExportRequest
+		{
+			Pattern pattern;
+			PatternEngine::StyleDefinitionPtr style;
+			juce::String styleName;
+			uint32_t seed = 0;
+			int slot = 0;
+			float intensity = 0.5f;
+			bool tripletMode = false;
+			uint32_t version = 0;
+		};
+
+		class ExportThread : public juce::Thread
+		{
+		public:
+			explicit ExportThread(PatternGrid& g) : juce::Thread("BeatCrafter MIDI Export"), grid(g) {}
+			~ExportThread() override { stopThread(2000); }
+			void run() override;
+
+		private:
+			PatternGrid& grid;
+		};
+
+		const PlaybackPattern* currentPattern = nullptr;
 		PatternEngine* patternEngine = nullptr;
 		ModernLookAndFeel* lookAndFeel = nullptr;
 
@@ -31,11 +60,29 @@ namespace BeatCrafter {
 		int   headerWidth = 60;
 		int   headerHeight = 20;
 		int   playheadPosition = -1;
+		int   displayedLength = 16;
 
 		juce::Image offscreenBuffer;
 		bool bufferDirty = true;
 
+		juce::CriticalSection renderLock;
+		std::unique_ptr<PatternEngine> exportEngine;
+		juce::CriticalSection exportLock;
+		std::unique_ptr<ExportRequest> pendingExport;
+		juce::File loopExportFile;
+		juce::File evolvingExportFile;
+		juce::File draggedExportFile;
+		uint32_t exportedVersion = 0;
+		uint32_t requestedExportVersion = 0;
+		bool isDraggingExport = false;
+
 		juce::Rectangle<float> getStepBounds(int track, int step) const;
+		void refreshFromSnapshot();
+		std::unique_ptr<ExportRequest> createExportRequest();
+		void requestExport();
+		void renderExport(const ExportRequest& request);
+		juce::File writeExportFile(PatternEngine& engine, const MidiRenderer::Settings& settings,
+			const juce::String& name, const juce::File& previous);
 
 		void drawBackground(juce::Graphics&);
 		void drawLEDs(juce::Graphics& g);
@@ -43,6 +90,8 @@ namespace BeatCrafter {
 		void drawTrackLabels(juce::Graphics&);
 		void drawStepNumbers(juce::Graphics&);
 
+		ExportThread exportThread{ *this };
+
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternGrid)
 	};
 }
\ No newline at end of file
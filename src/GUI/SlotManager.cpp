@@ -43,15 +43,28 @@ namespace BeatCrafter
 		g.drawText(getButtonText(), bounds, juce::Justification::centred);
 	}
 
+	void SlotButton::mouseDown(const juce::MouseEvent& event)
+	{
+		if (event.mods.isPopupMenu())
+		{
+			if (onStyleMenuRequested)
+				onStyleMenuRequested();
+			return;
+		}
+
+		juce::TextButton::mouseDown(event);
+	}
+
 	SlotManager::SlotManager(PatternEngine& engine) : patternEngine(engine)
 	{
 		for (int i = 0; i < 8; ++i)
 		{
-			StyleType slotStyle = patternEngine.getSlotStyle(i);
 			slotButtons[i] = std::make_unique<SlotButton>(i);
-			slotButtons[i]->setButtonText(styleTypeToString(slotStyle));
+			slotButtons[i]->setButtonText(getSlotLabel(i));
 			slotButtons[i]->onClick = [this, i]()
 				{ onSlotClicked(i); };
+			slotButtons[i]->onStyleMenuRequested = [this, i]()
+				{ showStyleMenu(i); };
 			slotButtons[i]->setMouseCursor(juce::MouseCursor::PointingHandCursor);
 			addAndMakeVisible(slotButtons[i].get());
 		}
@@ -84,6 +97,12 @@ namespace BeatCrafter
 		}
 	}
 
+	juce::String SlotManager::getSlotLabel(int slot)
+	{
+		auto packStyleName = patternEngine.getSlotStyleName(slot);
+		return packStyleName.isNotEmpty() ? packStyleName : styleTypeToString(patternEngine.getSlotStyle(slot));
+	}
+
 	void SlotManager::resized()
 	{
 		auto bounds = getLocalBounds();
@@ -99,24 +118,22 @@ namespace BeatCrafter
 		int activeSlot = forceActiveSlot >= 0 ? forceActiveSlot : patternEngine.getActiveSlot();
 		for (int i = 0; i < 8; ++i)
 		{
-			bool hasPattern = patternEngine.getSlot(i) != nullptr;
+			bool hasPattern = patternEngine.hasSlot(i);
 			bool isActive = (i == activeSlot);
 			slotButtons[i]->setSlotState(hasPattern, isActive);
-			slotButtons[i]->setButtonText(styleTypeToString(patternEngine.getSlotStyle(i)));
+			slotButtons[i]->setButtonText(getSlotLabel(i));
 		}
 	}
 
 	void SlotManager::onSlotClicked(int slot)
 	{
 		float currentIntensity = getIntensity ? getIntensity() : 0.5f;
-		StyleType slotStyle = patternEngine.getSlotStyle(slot);
-		if (!patternEngine.getSlot(slot))
-			patternEngine.generateNewPatternForSlot(slot, slotStyle, currentIntensity);
-		patternEngine.switchToSlot(slot, true, currentIntensity);
+		patternEngine.ensureSlot(slot);
+		patternEngine.postCommand({ PatternEngine::CommandType::SwitchSlot, slot, currentIntensity, true });
 
 		for (int i = 0; i < 8; ++i)
 		{
-			bool hasPattern = patternEngine.getSlot(i) != nullptr;
+			bool hasPattern = patternEngine.hasSlot(i);
 			bool isActive = (i == slot);
 			slotButtons[i]->setSlotState(hasPattern, isActive);
 		}
@@ -125,4 +142,40 @@ namespace BeatCrafter
 		if (onSlotChanged)
 			onSlotChanged(slot);
 	}
+
+	void SlotManager::showStyleMenu(int slot)
+	{
+		auto currentPackStyle = patternEngine.getSlotStyleName(slot);
+		auto currentStyle = patternEngine.getSlotStyle(slot);
+
+		juce::PopupMenu menu;
+		for (int i = 0; i <= (int)StyleType::Punk; ++i)
+			menu.addItem(i + 1, styleTypeToString((StyleType)i), true,
+				currentPackStyle.isEmpty() && currentStyle == (StyleType)i);
+
+		auto packStyles = getPackStyleNames ? getPackStyleNames() : juce::StringArray();
+		if (!packStyles.isEmpty())
+		{
+			menu.addSectionHeader("Style packs");
+			for (int i = 0; i < packStyles.size(); ++i)
+				menu.addItem(packStyleItemBase + i, packStyles[i], true, packStyles[i] == currentPackStyle);
+		}
+
+		menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(slotButtons[slot].get()),
+			[this, slot, packStyles](int result)
+			{
+				if (result <= 0)
+					return;
+
+				if (result >= packStyleItemBase)
+				{
+					if (onSlotPackStyleChosen)
+						onSlotPackStyleChosen(slot, packStyles[result - packStyleItemBase]);
+				}
+				else if (onSlotStyleChosen)
+					onSlotStyleChosen(slot, (StyleType)(result - 1));
+
+				updateSlotStates();
+			});
+	}
 }
\ No newline at end of file
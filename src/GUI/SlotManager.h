@@ -25,6 +25,10 @@ namespace BeatCrafter
 		void paintButton(juce::Graphics& g, bool shouldDrawButtonAsHighlighted,
 			bool shouldDrawButtonAsDown) override;
 
+		void mouseDown(const juce::MouseEvent& event) override;
+
+		std::function<void()> onStyleMenuRequested;
+
 	private:
 		int slotNumber;
 		bool hasPattern = false;
@@ -42,12 +46,19 @@ namespace BeatCrafter
 		void updateSlotStates(int forceActiveSlot = -1);
 		std::function<void(int slot)> onSlotChanged;
 		std::function<float()> getIntensity;
+		std::function<juce::StringArray()> getPackStyleNames;
+		std::function<void(int slot, StyleType style)> onSlotStyleChosen;
+		std::function<void(int slot, const juce::String& packStyleName)> onSlotPackStyleChosen;
 
 	private:
 		PatternEngine& patternEngine;
 		std::array<std::unique_ptr<SlotButton>, 8> slotButtons;
 		juce::String styleTypeToString(StyleType style);
+		juce::String getSlotLabel(int slot);
 		void onSlotClicked(int slot);
+		void showStyleMenu(int slot);
+
+		static constexpr int packStyleItemBase = 100;
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SlotManager)
 	};
@@ -36,10 +36,6 @@ namespace BeatCrafter
 					juce::dontSendNotification);
 				liveJamIntensitySlider.setValue(processor.liveJamIntensityParam->get(),
 					juce::dontSendNotification);
-				processor.getPatternEngine().perfParams.surpriseMeEnabled =
-					processor.surpriseMeParam->get();
-				processor.getPatternEngine().perfParams.tripletMode =
-					processor.tripletModeParam->get();
 				updateMidiLearnButtons(); });
 	}
 
@@ -57,8 +53,11 @@ namespace BeatCrafter
 		addAndMakeVisible(intensityIndicator.get());
 		patternGrid = std::make_unique<PatternGrid>();
 		patternGrid->markDirty();
-		patternGrid->setPattern(processor.getPatternEngine().getDisplayPattern());
 		patternGrid->setPatternEngine(&processor.getPatternEngine());
+		patternGrid->getTripletMode = [this]()
+			{
+				return processor.editorMailbox.tripletMode.load();
+			};
 		addAndMakeVisible(patternGrid.get());
 
 		slotManager = std::make_unique<SlotManager>(processor.getPatternEngine());
@@ -70,6 +69,18 @@ namespace BeatCrafter
 			{
 				return processor.intensityParam->get();
 			};
+		slotManager->getPackStyleNames = [this]()
+			{
+				return processor.getStyleLibrary().getStyleNames();
+			};
+		slotManager->onSlotStyleChosen = [this](int slot, StyleType style)
+			{
+				processor.changeSlotStyle(slot, style);
+			};
+		slotManager->onSlotPackStyleChosen = [this](int slot, const juce::String& packStyleName)
+			{
+				processor.changeSlotStyle(slot, packStyleName);
+			};
 
 		addAndMakeVisible(slotManager.get());
 
@@ -97,7 +108,6 @@ namespace BeatCrafter
 			{
 				bool active = !processor.surpriseMeParam->get();
 				processor.surpriseMeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-				processor.getPatternEngine().perfParams.surpriseMeEnabled = active;
 
 				if (!active)
 					processor.intensityParam->setValueNotifyingHost((float)intensitySlider.getValue());
@@ -118,13 +128,12 @@ namespace BeatCrafter
 
 		tripletModeButton.onClick = [this]()
 			{
-				if (processor.isMidiLearning() && processor.getMidiLearnTarget() == 4)
+				if (processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::TripletMode))
 					processor.stopMidiLearn();
 				else
 				{
 					bool active = !processor.tripletModeParam->get();
 					processor.tripletModeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-					processor.getPatternEngine().perfParams.tripletMode = active;
 				}
 				updateMidiLearnButtons();
 			};
@@ -157,20 +166,6 @@ namespace BeatCrafter
 		intensitySlider.setMouseCursor(juce::MouseCursor::PointingHandCursor);
 		addAndMakeVisible(intensitySlider);
 
-		juce::Component::SafePointer<BeatCrafterEditor> safeThis(this);
-
-		processor.getPatternEngine().onIntensityChanged = [safeThis](float newIntensity)
-			{
-				juce::MessageManager::callAsync([safeThis, newIntensity]()
-					{
-						if (auto* editor = safeThis.getComponent())
-						{
-							editor->intensityIndicator->setValue(newIntensity);
-							editor->intensityIndicator->setSurpriseMeActive(editor->processor.surpriseMeParam->get());
-						}
-					});
-			};
-
 		intensityLabel.setText("Intensity", juce::dontSendNotification);
 		intensityLabel.setColour(juce::Label::textColourId, modernLookAndFeel.textColour);
 		intensityLabel.setJustificationType(juce::Justification::centred);
@@ -219,29 +214,24 @@ namespace BeatCrafter
 
 	void BeatCrafterEditor::handleSlotSwitched(int slot)
 	{
-		bool surpriseActive = processor.surpriseMeParam->get();
-		float currentIntensity = surpriseActive
-			? processor.getPatternEngine().getIntensity()
-			: processor.intensityParam->get();
-
-		processor.getPatternEngine().setIntensity(currentIntensity);
 		processor.getPatternEngine().invalidateCache();
 
 		slotManager->updateSlotStates(slot);
 		patternGrid->markDirty();
-		patternGrid->setPattern(processor.getPatternEngine().getDisplayPattern());
 
-		lastRepaintIntensity = currentIntensity;
+		lastRepaintIntensity = processor.surpriseMeParam->get()
+			? processor.getPatternEngine().getIntensity()
+			: processor.intensityParam->get();
 	}
 
 	void BeatCrafterEditor::onTripletModeMidiLearnClicked()
 	{
 		if (processor.isMidiLearning())
 			processor.stopMidiLearn();
-		else if (processor.hasMidiMapping(4, -1))
-			processor.clearMidiMapping(4, -1);
+		else if (processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::TripletMode))
+			processor.clearMidiMapping(BeatCrafterProcessor::MidiTarget::TripletMode);
 		else
-			processor.startMidiLearn(4, -1);
+			processor.startMidiLearn(BeatCrafterProcessor::MidiTarget::TripletMode);
 		updateMidiLearnButtons();
 	}
 
@@ -249,10 +239,10 @@ namespace BeatCrafter
 	{
 		if (processor.isMidiLearning())
 			processor.stopMidiLearn();
-		else if (processor.hasMidiMapping(3, -1))
-			processor.clearMidiMapping(3, -1);
+		else if (processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::SurpriseMe))
+			processor.clearMidiMapping(BeatCrafterProcessor::MidiTarget::SurpriseMe);
 		else
-			processor.startMidiLearn(3, -1);
+			processor.startMidiLearn(BeatCrafterProcessor::MidiTarget::SurpriseMe);
 		updateMidiLearnButtons();
 	}
 
@@ -377,6 +367,19 @@ namespace BeatCrafter
 
 	void BeatCrafterEditor::timerCallback()
 	{
+		auto& mailbox = processor.editorMailbox;
+		auto events = mailbox.collect();
+		if (events & BeatCrafterProcessor::EditorMailbox::slotSwitched)
+			handleSlotSwitched(mailbox.switchedSlot);
+		if (events & BeatCrafterProcessor::EditorMailbox::intensityChanged)
+			updateIntensitySlider(mailbox.intensity);
+		if (events & BeatCrafterProcessor::EditorMailbox::liveJamIntensityChanged)
+			updateLiveJamIntensitySlider(mailbox.liveJamIntensity);
+		if (events & BeatCrafterProcessor::EditorMailbox::midiLearned)
+			processor.commitLearnedMidiMapping();
+		if (events & (BeatCrafterProcessor::EditorMailbox::controlsChanged | BeatCrafterProcessor::EditorMailbox::midiLearned))
+			updateMidiLearnButtons();
+
 		bool surpriseActive = processor.surpriseMeParam->get();
 		float lfoIntensity = processor.getPatternEngine().getIntensity();
 		float paramIntensity = processor.intensityParam->get();
@@ -391,25 +394,18 @@ namespace BeatCrafter
 		if (std::abs(liveJamIntensitySlider.getValue() - paramLiveJam) > 0.005f)
 			liveJamIntensitySlider.setValue(paramLiveJam, juce::dontSendNotification);
 
-		processor.getPatternEngine().setLiveJamIntensity(
-			processor.liveJamIntensityParam->get());
-
 		float repaintIntensity = surpriseActive ? lfoIntensity : paramIntensity;
 		if (std::abs(repaintIntensity - lastRepaintIntensity) > 0.02f)
 		{
 			patternGrid->markDirty();
-			patternGrid->setPattern(processor.getPatternEngine().getDisplayPattern());
 			lastRepaintIntensity = repaintIntensity;
 		}
 	}
 
 	void BeatCrafterEditor::updatePatternDisplay()
 	{
-		auto& engine = processor.getPatternEngine();
-		engine.setIntensity(processor.intensityParam->get());
-		engine.invalidateCache();
+		processor.getPatternEngine().invalidateCache();
 		patternGrid->markDirty();
-		patternGrid->setPattern(engine.getDisplayPattern());
 	}
 
 	void BeatCrafterEditor::applyToggleButtonState(IconButton& btn,
@@ -463,9 +459,9 @@ namespace BeatCrafter
 	{
 		updateMidiLearnPair(
 			intensityMidiLearnButton, intensityMidiLabel,
-			processor.isMidiLearning() && processor.getMidiLearnTarget() == 0,
-			processor.hasMidiMapping(0, -1),
-			processor.getMidiMappingDescription(0, -1),
+			processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::Intensity),
+			processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::Intensity),
+			processor.getMidiMappingDescription(BeatCrafterProcessor::MidiTarget::Intensity),
 			"Assign a MIDI CC to the intensity");
 		intensityMidiLearnButton.setIconPadding(ModernLookAndFeel::iconPaddingHard);
 
@@ -473,17 +469,17 @@ namespace BeatCrafter
 		{
 			updateMidiLearnPair(
 				*slotMidiLearnButtons[i], slotMidiLabels[i],
-				processor.isMidiLearning() && processor.getMidiLearnTarget() >= 1 && processor.getMidiLearnSlot() == i,
-				processor.hasMidiMapping(1, i),
-				processor.getMidiMappingDescription(1, i),
+				processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::Slot, i),
+				processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::Slot, i),
+				processor.getMidiMappingDescription(BeatCrafterProcessor::MidiTarget::Slot, i),
 				"Assign a MIDI CC to slot " + juce::String(i + 1));
 		}
 
 		updateMidiLearnPair(
 			liveJamIntensityMidiLearnButton, liveJamIntensityMidiLabel,
-			processor.isMidiLearning() && processor.getMidiLearnTarget() == 2,
-			processor.hasMidiMapping(2, -1),
-			processor.getMidiMappingDescription(2, -1),
+			processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::LiveJamIntensity),
+			processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::LiveJamIntensity),
+			processor.getMidiMappingDescription(BeatCrafterProcessor::MidiTarget::LiveJamIntensity),
 			"Assign a MIDI CC to Chaos");
 		liveJamIntensityMidiLearnButton.setIconPadding(ModernLookAndFeel::iconPaddingHard);
 
@@ -494,9 +490,9 @@ namespace BeatCrafter
 
 		updateMidiLearnPair(
 			surpriseMeMidiLearnButton, surpriseMeMidiLabel,
-			processor.isMidiLearning() && processor.getMidiLearnTarget() == 3,
-			processor.hasMidiMapping(3, -1),
-			processor.getMidiMappingDescription(3, -1),
+			processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::SurpriseMe),
+			processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::SurpriseMe),
+			processor.getMidiMappingDescription(BeatCrafterProcessor::MidiTarget::SurpriseMe),
 			"Assign a MIDI CC to Surprise Me");
 		surpriseMeMidiLearnButton.setIconPadding(ModernLookAndFeel::iconPaddingHard);
 
@@ -507,9 +503,9 @@ namespace BeatCrafter
 
 		updateMidiLearnPair(
 			tripletModeMidiLearnButton, tripletModeMidiLabel,
-			processor.isMidiLearning() && processor.getMidiLearnTarget() == 4,
-			processor.hasMidiMapping(4, -1),
-			processor.getMidiMappingDescription(4, -1),
+			processor.isMidiLearning(BeatCrafterProcessor::MidiTarget::TripletMode),
+			processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::TripletMode),
+			processor.getMidiMappingDescription(BeatCrafterProcessor::MidiTarget::TripletMode),
 			"Assign a MIDI CC to Triplet Mode");
 		tripletModeMidiLearnButton.setIconPadding(ModernLookAndFeel::iconPaddingHard);
 	}
@@ -518,10 +514,10 @@ namespace BeatCrafter
 	{
 		if (processor.isMidiLearning())
 			processor.stopMidiLearn();
-		else if (processor.hasMidiMapping(0, -1))
-			processor.clearMidiMapping(0, -1);
+		else if (processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::Intensity))
+			processor.clearMidiMapping(BeatCrafterProcessor::MidiTarget::Intensity);
 		else
-			processor.startMidiLearn(0, -1);
+			processor.startMidiLearn(BeatCrafterProcessor::MidiTarget::Intensity);
 		updateMidiLearnButtons();
 	}
 
@@ -529,10 +525,10 @@ namespace BeatCrafter
 	{
 		if (processor.isMidiLearning())
 			processor.stopMidiLearn();
-		else if (processor.hasMidiMapping(1, slot))
-			processor.clearMidiMapping(1, slot);
+		else if (processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::Slot, slot))
+			processor.clearMidiMapping(BeatCrafterProcessor::MidiTarget::Slot, slot);
 		else
-			processor.startMidiLearn(1, slot);
+			processor.startMidiLearn(BeatCrafterProcessor::MidiTarget::Slot, slot);
 		updateMidiLearnButtons();
 	}
 
@@ -540,10 +536,10 @@ namespace BeatCrafter
 	{
 		if (processor.isMidiLearning())
 			processor.stopMidiLearn();
-		else if (processor.hasMidiMapping(2, -1))
-			processor.clearMidiMapping(2, -1);
+		else if (processor.hasMidiMapping(BeatCrafterProcessor::MidiTarget::LiveJamIntensity))
+			processor.clearMidiMapping(BeatCrafterProcessor::MidiTarget::LiveJamIntensity);
 		else
-			processor.startMidiLearn(2, -1);
+			processor.startMidiLearn(BeatCrafterProcessor::MidiTarget::LiveJamIntensity);
 		updateMidiLearnButtons();
 	}
 
@@ -551,7 +547,6 @@ namespace BeatCrafter
 	{
 		intensitySlider.setValue(processor.intensityParam->get(), juce::dontSendNotification);
 		patternGrid->markDirty();
-		patternGrid->setPattern(&processor.getPatternEngine().getCurrentPattern());
 		slotManager->updateSlotStates();
 		updateMidiLearnButtons();
 	}
@@ -18,15 +18,15 @@ namespace BeatCrafter
 		addParameter(tripletModeParam = new juce::AudioParameterBool(
 			"tripletMode", "Triplet Mode", false));
 
+		styleLibrary.loadDirectory(StyleLibrary::getDefaultDirectory());
+
 		patternEngine.setLiveJamMode(true);
 		liveJamModeState = true;
 		patternEngine.onIntensityChanged = [this](float newIntensity)
 			{
 				intensityParam->setValueNotifyingHost(newIntensity);
-				juce::MessageManager::callAsync([this, newIntensity]()
-					{
-						if (auto* editor = dynamic_cast<BeatCrafterEditor*>(getActiveEditor()))
-							editor->updateIntensitySlider(newIntensity); });
+				editorMailbox.intensity = newIntensity;
+				editorMailbox.post(EditorMailbox::intensityChanged);
 			};
 	}
 
@@ -34,6 +34,33 @@ namespace BeatCrafter
 	{
 	}
 
+	bool BeatCrafterProcessor::setSlotStyle(int slot, const juce::String& packStyleName)
+	{
+		auto definition = styleLibrary.find(packStyleName);
+		if (!definition)
+			return false;
+
+		patternEngine.setSlotStyle(slot, std::move(definition), packStyleName);
+		return true;
+	}
+
+	void BeatCrafterProcessor::changeSlotStyle(int slot, StyleType style)
+	{
+		patternEngine.setSlotStyle(slot, style);
+		patternEngine.resetSlot(slot);
+		patternEngine.requestSlot(slot);
+	}
+
+	bool BeatCrafterProcessor::changeSlotStyle(int slot, const juce::String& packStyleName)
+	{
+		if (!setSlotStyle(slot, packStyleName))
+			return false;
+
+		patternEngine.resetSlot(slot);
+		patternEngine.requestSlot(slot);
+		return true;
+	}
+
 	void BeatCrafterProcessor::prepareToPlay(double sampleRate, int /*samplesPerBlock*/)
 	{
 		currentSampleRate = sampleRate;
@@ -66,11 +93,12 @@ namespace BeatCrafter
 		if (!posInfo.hasValue())
 			return;
 
+		bool tripletMode = tripletModeParam->get();
 		patternEngine.setIntensity(intensityParam->get());
 		patternEngine.setLiveJamIntensity(liveJamIntensityParam->get());
-		patternEngine.perfParams.surpriseMeEnabled =
-			surpriseMeParam->get();
-		patternEngine.perfParams.tripletMode = tripletModeParam->get();
+		patternEngine.setSurpriseMeEnabled(surpriseMeParam->get());
+		patternEngine.setTripletMode(tripletMode);
+		editorMailbox.tripletMode = tripletMode;
 
 		bool hostIsPlaying = posInfo->getIsPlaying();
 
@@ -96,34 +124,27 @@ namespace BeatCrafter
 	void BeatCrafterProcessor::setLiveJamMode(bool enabled)
 	{
 		liveJamModeState = enabled;
-		patternEngine.setLiveJamMode(enabled);
+		patternEngine.postCommand({ PatternEngine::CommandType::SetLiveJamMode, -1, 0.0f, enabled });
 	}
 
 	void BeatCrafterProcessor::setupDefaultMidiMappings()
 	{
-		intensityMapping.ccNumber = 16;
-		intensityMapping.channel = 0;
-		intensityMapping.isNote = false;
-		intensityMapping.isProgramChange = false;
-
-		liveJamIntensityMapping.ccNumber = 17;
-		liveJamIntensityMapping.channel = 0;
-		liveJamIntensityMapping.isNote = false;
-		liveJamIntensityMapping.isProgramChange = false;
-
-		for (int i = 0; i < 8; ++i)
 		{
-			slotMappings[i].ccNumber = 36 + i;
-			slotMappings[i].channel = 0;
-			slotMappings[i].isNote = true;
-			slotMappings[i].isProgramChange = false;
+			const juce::ScopedLock sl(midiMappingLock);
+			midiMappings[(size_t)getMappingIndex(MidiTarget::Intensity)] = { 16, 0, false, false };
+			midiMappings[(size_t)getMappingIndex(MidiTarget::LiveJamIntensity)] = { 17, 0, false, false };
+			for (int i = 0; i < 8; ++i)
+				midiMappings[(size_t)getMappingIndex(MidiTarget::Slot, i)] = { 36 + i, 0, true, false };
 		}
+
+		rebuildMidiDispatch();
 	}
 
 	void BeatCrafterProcessor::processMidi(juce::MidiBuffer& midiMessages)
 	{
 		juce::MidiBuffer processedMidi;
 		bool slotJustSwitched = false;
+		midiDispatch.update();
 
 		for (const auto metadata : midiMessages)
 		{
@@ -133,16 +154,14 @@ namespace BeatCrafter
 				int ccNumber = message.getControllerNumber();
 				int channel = message.getChannel() - 1;
 				int value = message.getControllerValue();
-				if (midiLearnMode)
+				if (isMidiLearning())
 				{
-					learnByType(ccNumber, channel);
+					learnMidiSource(MidiSource::Controller, ccNumber, channel);
 				}
 				else
 				{
 					if (slotJustSwitched &&
-						intensityMapping.isValid() && !intensityMapping.isNote &&
-						ccNumber == intensityMapping.ccNumber &&
-						channel == intensityMapping.channel)
+						lookupMidiAction(MidiSource::Controller, ccNumber, channel).target == MidiTarget::Intensity)
 						continue;
 					processForCC(ccNumber, channel, value);
 				}
@@ -151,9 +170,9 @@ namespace BeatCrafter
 			{
 				int programNumber = message.getProgramChangeNumber();
 				int channel = message.getChannel() - 1;
-				if (midiLearnMode)
+				if (isMidiLearning())
 				{
-					learnForPC(programNumber, channel);
+					learnMidiSource(MidiSource::ProgramChange, programNumber, channel);
 				}
 				else
 				{
@@ -166,9 +185,9 @@ namespace BeatCrafter
 				int noteNumber = message.getNoteNumber();
 				int channel = message.getChannel() - 1;
 				int velocity = message.getVelocity();
-				if (midiLearnMode)
+				if (isMidiLearning())
 				{
-					learnForNoteOn(noteNumber, channel);
+					learnMidiSource(MidiSource::Note, noteNumber, channel);
 				}
 				else
 				{
@@ -186,153 +205,47 @@ namespace BeatCrafter
 
 	void BeatCrafterProcessor::processPC(int programNumber, int channel)
 	{
-		for (int i = 0; i < 8; ++i)
-		{
-			if (slotMappings[i].isValid() &&
-				slotMappings[i].isProgramChange &&
-				programNumber == slotMappings[i].ccNumber &&
-				channel == slotMappings[i].channel)
-			{
-				if (!getPatternEngine().getSlot(i))
-				{
-					StyleType style = getPatternEngine().getSlotStyle(i);
-					getPatternEngine().generateNewPatternForSlot(
-						i, style, intensityParam->get());
-				}
+		const auto& action = lookupMidiAction(MidiSource::ProgramChange, programNumber, channel);
+		if (action.target != MidiTarget::Slot)
+			return;
 
-				getPatternEngine().switchToSlot(i, true, intensityParam->get());
-				juce::MessageManager::callAsync([this, i]()
-					{
-						if (auto* editor = getActiveEditor())
-							if (auto* ce = dynamic_cast<BeatCrafterEditor*>(editor))
-								ce->handleSlotSwitched(i); });
-				break;
-			}
-		}
+		int slot = action.slot;
+		getPatternEngine().requestSlot(slot);
+		getPatternEngine().switchToSlot(slot, true, intensityParam->get());
+		editorMailbox.switchedSlot = slot;
+		editorMailbox.post(EditorMailbox::slotSwitched);
 	}
 
 	void BeatCrafterProcessor::processMidiNoteOn(int noteNumber, int channel, int /*velocity*/)
 	{
-		for (int i = 0; i < 8; ++i)
+		const auto& action = lookupMidiAction(MidiSource::Note, noteNumber, channel);
+		switch (action.target)
 		{
-			if (slotMappings[i].isValid() && slotMappings[i].isNote &&
-				noteNumber == slotMappings[i].ccNumber &&
-				channel == slotMappings[i].channel)
-			{
-				if (!getPatternEngine().getSlot(i))
-				{
-					StyleType style = getPatternEngine().getSlotStyle(i);
-					getPatternEngine().generateNewPatternForSlot(
-						i, style, intensityParam->get());
-				}
-				float dbgIntensity = intensityParam->get();
-				getPatternEngine().setIntensity(dbgIntensity);
-				getPatternEngine().switchToSlot(i, true, dbgIntensity);
-				juce::MessageManager::callAsync([this, i]()
-					{
-						if (auto* editor = getActiveEditor())
-							if (auto* ce = dynamic_cast<BeatCrafterEditor*>(editor))
-								ce->handleSlotSwitched(i); });
-				return;
-			}
+		case MidiTarget::Slot:
+		{
+			int slot = action.slot;
+			getPatternEngine().requestSlot(slot);
+			getPatternEngine().switchToSlot(slot, true, intensityParam->get());
+			editorMailbox.switchedSlot = slot;
+			editorMailbox.post(EditorMailbox::slotSwitched);
+			break;
 		}
-
-		if (surpriseMeMapping.isValid() && surpriseMeMapping.isNote &&
-			noteNumber == surpriseMeMapping.ccNumber &&
-			channel == surpriseMeMapping.channel)
+		case MidiTarget::SurpriseMe:
 		{
 			bool active = !surpriseMeParam->get();
 			surpriseMeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-			getPatternEngine().perfParams.surpriseMeEnabled = active;
-			juce::MessageManager::callAsync([this]()
-				{
-					if (auto* editor = dynamic_cast<BeatCrafterEditor*>(getActiveEditor()))
-						editor->updateMidiLearnButtons(); });
+			editorMailbox.post(EditorMailbox::controlsChanged);
+			break;
 		}
-
-		if (tripletModeMapping.isValid() && tripletModeMapping.isNote &&
-			noteNumber == tripletModeMapping.ccNumber &&
-			channel == tripletModeMapping.channel)
+		case MidiTarget::TripletMode:
 		{
 			bool active = !tripletModeParam->get();
 			tripletModeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-			getPatternEngine().perfParams.tripletMode = active;
-			juce::MessageManager::callAsync([this]()
-				{
-					if (auto* editor = dynamic_cast<BeatCrafterEditor*>(getActiveEditor()))
-						editor->updateMidiLearnButtons(); });
-		}
-	}
-
-	void BeatCrafterProcessor::learnForNoteOn(int noteNumber, int channel)
-	{
-		if (midiLearnTargetType == 0)
-		{
-			intensityMapping.ccNumber = noteNumber;
-			intensityMapping.channel = channel;
-			intensityMapping.isNote = true;
-			intensityMapping.isProgramChange = false;
-			stopMidiLearn();
+			editorMailbox.post(EditorMailbox::controlsChanged);
+			break;
 		}
-		else if (midiLearnTargetType == 1)
-		{
-			if (midiLearnTargetSlot >= 0 && midiLearnTargetSlot < 8)
-			{
-				slotMappings[midiLearnTargetSlot].ccNumber = noteNumber;
-				slotMappings[midiLearnTargetSlot].channel = channel;
-				slotMappings[midiLearnTargetSlot].isNote = true;
-				slotMappings[midiLearnTargetSlot].isProgramChange = false;
-				stopMidiLearn();
-			}
-			else
-			{
-				DBG("Invalid slot index in MIDI learn: " + juce::String(midiLearnTargetSlot));
-				stopMidiLearn();
-			}
-		}
-		else if (midiLearnTargetType == 2)
-		{
-			liveJamIntensityMapping.ccNumber = noteNumber;
-			liveJamIntensityMapping.channel = channel;
-			liveJamIntensityMapping.isNote = true;
-			liveJamIntensityMapping.isProgramChange = false;
-			stopMidiLearn();
-		}
-		else if (midiLearnTargetType == 3)
-		{
-			surpriseMeMapping.ccNumber = noteNumber;
-			surpriseMeMapping.channel = channel;
-			surpriseMeMapping.isNote = true;
-			surpriseMeMapping.isProgramChange = false;
-			stopMidiLearn();
-		}
-		else if (midiLearnTargetType == 4)
-		{
-			tripletModeMapping.ccNumber = noteNumber;
-			tripletModeMapping.channel = channel;
-			tripletModeMapping.isNote = true;
-			tripletModeMapping.isProgramChange = false;
-			stopMidiLearn();
-		}
-	}
-
-	void BeatCrafterProcessor::learnForPC(int programNumber, int channel)
-	{
-		if (midiLearnTargetType == 1)
-		{
-			if (midiLearnTargetSlot >= 0 && midiLearnTargetSlot < 8)
-			{
-				slotMappings[midiLearnTargetSlot].ccNumber = programNumber;
-				slotMappings[midiLearnTargetSlot].channel = channel;
-				slotMappings[midiLearnTargetSlot].isNote = false;
-				slotMappings[midiLearnTargetSlot].isProgramChange = true;
-				stopMidiLearn();
-			}
-			else
-			{
-				DBG("Invalid slot index in MIDI learn: " + juce::String(midiLearnTargetSlot));
-				stopMidiLearn();
-			}
+		default:
+			break;
 		}
 	}
 
@@ -340,123 +253,161 @@ namespace BeatCrafter
 	{
 		if ((ccNumber == 0 || ccNumber == 32) && value == 0)
 			return;
-		if (intensityMapping.isValid() && !intensityMapping.isNote &&
-			ccNumber == intensityMapping.ccNumber &&
-			channel == intensityMapping.channel)
+
+		const auto& action = lookupMidiAction(MidiSource::Controller, ccNumber, channel);
+		switch (action.target)
+		{
+		case MidiTarget::Intensity:
 		{
 			float newIntensity = value / 127.0f;
 			intensityParam->setValueNotifyingHost(newIntensity);
-			juce::MessageManager::callAsync([this, newIntensity]()
-				{
-					if (auto* editor = getActiveEditor()) {
-						if (auto* customEditor = dynamic_cast<BeatCrafterEditor*>(editor)) {
-							customEditor->updateIntensitySlider(newIntensity);
-						}
-					} });
+			editorMailbox.intensity = newIntensity;
+			editorMailbox.post(EditorMailbox::intensityChanged);
+			break;
 		}
-		if (liveJamIntensityMapping.isValid() && !liveJamIntensityMapping.isNote &&
-			ccNumber == liveJamIntensityMapping.ccNumber &&
-			channel == liveJamIntensityMapping.channel)
+		case MidiTarget::LiveJamIntensity:
 		{
 			float newLiveJamIntensity = value / 127.0f;
 			liveJamIntensityParam->setValueNotifyingHost(newLiveJamIntensity);
-			juce::MessageManager::callAsync([this, newLiveJamIntensity]()
-				{
-					if (auto* editor = getActiveEditor()) {
-						if (auto* customEditor = dynamic_cast<BeatCrafterEditor*>(editor)) {
-							customEditor->updateLiveJamIntensitySlider(newLiveJamIntensity);
-						}
-					} });
+			editorMailbox.liveJamIntensity = newLiveJamIntensity;
+			editorMailbox.post(EditorMailbox::liveJamIntensityChanged);
+			break;
 		}
-		if (surpriseMeMapping.isValid() && !surpriseMeMapping.isNote &&
-			ccNumber == surpriseMeMapping.ccNumber &&
-			channel == surpriseMeMapping.channel)
+		case MidiTarget::SurpriseMe:
 		{
 			bool active = value >= 64;
 			surpriseMeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-			getPatternEngine().perfParams.surpriseMeEnabled = active;
+			break;
 		}
-		if (tripletModeMapping.isValid() && !tripletModeMapping.isNote &&
-			ccNumber == tripletModeMapping.ccNumber &&
-			channel == tripletModeMapping.channel)
+		case MidiTarget::TripletMode:
 		{
 			bool active = value >= 64;
 			tripletModeParam->setValueNotifyingHost(active ? 1.0f : 0.0f);
-			getPatternEngine().perfParams.tripletMode = active;
+			break;
 		}
-		for (int i = 0; i < 8; ++i)
-		{
-			if (slotMappings[i].isValid() && !slotMappings[i].isNote &&
-				ccNumber == slotMappings[i].ccNumber &&
-				channel == slotMappings[i].channel)
+		case MidiTarget::Slot:
+			if (value >= 64)
 			{
-				if (value >= 64)
-				{
-					getPatternEngine().setIntensity(intensityParam->get());
-					getPatternEngine().switchToSlot(i, true, intensityParam->get());
-					juce::MessageManager::callAsync([this, i]()
-						{
-							if (auto* editor = getActiveEditor()) {
-								if (auto* customEditor = dynamic_cast<BeatCrafterEditor*>(editor)) {
-									customEditor->handleSlotSwitched(i);
-								}
-							} });
-				}
-				break;
+				getPatternEngine().requestSlot(action.slot);
+				getPatternEngine().switchToSlot(action.slot, true, intensityParam->get());
+				editorMailbox.switchedSlot = (int)action.slot;
+				editorMailbox.post(EditorMailbox::slotSwitched);
 			}
+			break;
+		default:
+			break;
 		}
 	}
 
-	void BeatCrafterProcessor::learnByType(int ccNumber, int channel)
+	const BeatCrafterProcessor::MidiAction& BeatCrafterProcessor::lookupMidiAction(
+		MidiSource source, int number, int channel) const
 	{
-		if (midiLearnTargetType == 0)
-		{
-			intensityMapping.ccNumber = ccNumber;
-			intensityMapping.channel = channel;
-			intensityMapping.isNote = false;
-			intensityMapping.isProgramChange = false;
-			stopMidiLearn();
-		}
-		else if (midiLearnTargetType == 1)
+		static const MidiAction none;
+		if (number < 0 || number > 127 || channel < 0 || channel > 15)
+			return none;
+
+		const auto& table = midiDispatch.getReadBuffer();
+		return table[(size_t)(((int)source * 16 + channel) * 128 + number)];
+	}
+
+	void BeatCrafterProcessor::rebuildMidiDispatch()
+	{
+		const juce::ScopedLock sl(midiMappingLock);
+		mappingStateDirty = true;
+
+		auto& table = midiDispatch.getWriteBuffer();
+		table.fill(MidiAction{});
+
+		// Walk backwards so the first mapping bound to a source wins.
+		for (int i = numMidiMappings; --i >= 0;)
 		{
-			if (midiLearnTargetSlot >= 0 && midiLearnTargetSlot < 8)
-			{
-				slotMappings[midiLearnTargetSlot].ccNumber = ccNumber;
-				slotMappings[midiLearnTargetSlot].channel = channel;
-				slotMappings[midiLearnTargetSlot].isNote = false;
-				slotMappings[midiLearnTargetSlot].isProgramChange = false;
-				stopMidiLearn();
-			}
-			else
-			{
-				DBG("Invalid slot index in MIDI learn: " + juce::String(midiLearnTargetSlot));
-				stopMidiLearn();
-			}
+			const auto& mapping = midiMappings[(size_t)i];
+			if (!mapping.isValid() || mapping.ccNumber > 127 || mapping.channel > 15)
+				continue;
+
+			auto source = mapping.isProgramChange ? MidiSource::ProgramChange
+				: mapping.isNote ? MidiSource::Note : MidiSource::Controller;
+			table[(size_t)(((int)source * 16 + mapping.channel) * 128 + mapping.ccNumber)] = getMappingAction(i);
 		}
-		else if (midiLearnTargetType == 2)
+
+		midiDispatch.publish();
+	}
+
+	void BeatCrafterProcessor::learnMidiSource(MidiSource source, int number, int channel)
+	{
+		int index = midiLearnIndex.load();
+		if (index < 0)
+			return;
+
+		// Program changes carry no value, so they can only fire triggers.
+		const auto* info = findMidiTarget(getMappingAction(index).target);
+		if (source == MidiSource::ProgramChange && (info == nullptr || info->kind != MidiTargetKind::Trigger))
+			return;
+
+		if (!midiLearnIndex.compare_exchange_strong(index, -1))
+			return;
+
+		// Packed as index, source, channel and number; the editor commits it.
+		learnedMidiMapping = ((uint32_t)(index + 1) << 24) | ((uint32_t)source << 16)
+			| ((uint32_t)channel << 8) | (uint32_t)number;
+		editorMailbox.post(EditorMailbox::midiLearned);
+	}
+
+	void BeatCrafterProcessor::commitLearnedMidiMapping()
+	{
+		auto packed = learnedMidiMapping.exchange(0);
+		if (packed == 0)
+			return;
+
+		int index = (int)(packed >> 24) - 1;
+		auto source = (MidiSource)((packed >> 16) & 0xff);
+		MidiMapping mapping;
+		mapping.ccNumber = (int)(packed & 0xff);
+		mapping.channel = (int)((packed >> 8) & 0xff);
+		mapping.isNote = source == MidiSource::Note;
+		mapping.isProgramChange = source == MidiSource::ProgramChange;
+
 		{
-			liveJamIntensityMapping.ccNumber = ccNumber;
-			liveJamIntensityMapping.channel = channel;
-			liveJamIntensityMapping.isNote = false;
-			liveJamIntensityMapping.isProgramChange = false;
-			stopMidiLearn();
+			const juce::ScopedLock sl(midiMappingLock);
+			midiMappings[(size_t)index] = mapping;
 		}
-		else if (midiLearnTargetType == 3)
+		rebuildMidiDispatch();
+	}
+
+	int BeatCrafterProcessor::getMappingIndex(MidiTarget target, int slot)
+	{
+		int first = 0;
+		for (const auto& info : midiTargets)
 		{
-			surpriseMeMapping.ccNumber = ccNumber;
-			surpriseMeMapping.channel = channel;
-			surpriseMeMapping.isNote = false;
-			surpriseMeMapping.isProgramChange = false;
-			stopMidiLearn();
+			if (info.target == target)
+			{
+				if (info.numSlots == 1 && slot < 0)
+					slot = 0;
+				return (slot >= 0 && slot < info.numSlots) ? first + slot : -1;
+			}
+			first += info.numSlots;
 		}
-		else if (midiLearnTargetType == 4)
+		return -1;
+	}
+
+	BeatCrafterProcessor::MidiAction BeatCrafterProcessor::getMappingAction(int mappingIndex)
+	{
+		int first = 0;
+		for (const auto& info : midiTargets)
 		{
-			tripletModeMapping.ccNumber = ccNumber;
-			tripletModeMapping.channel = channel;
-			tripletModeMapping.isNote = false;
-			tripletModeMapping.isProgramChange = false;
-			stopMidiLearn();
+			if (mappingIndex >= first && mappingIndex < first + info.numSlots)
+				return { info.target, (int8_t)(info.numSlots > 1 ? mappingIndex - first : -1) };
+			first += info.numSlots;
 		}
+		return {};
+	}
+
+	const BeatCrafterProcessor::MidiTargetInfo* BeatCrafterProcessor::findMidiTarget(MidiTarget target)
+	{
+		for (const auto& info : midiTargets)
+			if (info.target == target)
+				return &info;
+		return nullptr;
 	}
 
 	juce::AudioProcessorEditor* BeatCrafterProcessor::createEditor()
@@ -476,322 +427,391 @@ namespace BeatCrafter
 
 	void BeatCrafterProcessor::getStateInformation(juce::MemoryBlock& destData)
 	{
-		auto state = juce::ValueTree("BeatCrafterState");
+		juce::MemoryOutputStream stream(destData, false);
+		stream.writeInt((int)stateMagic);
+		stream.writeShort((short)stateVersion);
 
-		state.setProperty("intensity", intensityParam->get(), nullptr);
-		state.setProperty("activeSlot", getPatternEngine().getActiveSlot(), nullptr);
-		state.setProperty("liveJamMode", liveJamModeState, nullptr);
-		state.setProperty("liveJamIntensity", liveJamIntensityParam->get(), nullptr);
-		state.setProperty("surpriseMe", surpriseMeParam->get(), nullptr);
-		state.setProperty("tripletMode", tripletModeParam->get(), nullptr);
+		stream.writeFloat(intensityParam->get());
+		stream.writeFloat(liveJamIntensityParam->get());
+		stream.writeByte((char)getPatternEngine().getActiveSlot());
+		stream.writeByte((char)((liveJamModeState ? stateLiveJamMode : 0)
+			| (surpriseMeParam->get() ? stateSurpriseMe : 0)
+			| (tripletModeParam->get() ? stateTripletMode : 0)));
 
 		for (int i = 0; i < 8; ++i)
 		{
-			juce::String styleProps = "slotStyle" + juce::String(i);
-			juce::String seedProps = "slotSeed" + juce::String(i);
-			state.setProperty(seedProps, (int)getPatternEngine().getSlotSeed(i), nullptr);
+			stream.writeByte((char)getPatternEngine().getSlotStyle(i));
+			stream.writeInt((int)getPatternEngine().getSlotSeed(i));
 		}
 
-		for (int slotIndex = 0; slotIndex < 8; ++slotIndex)
+		for (int i = 0; i < 8; ++i)
+			stream.writeString(getPatternEngine().getSlotStyleName(i));
+
 		{
-			Pattern* pattern = getPatternEngine().getSlot(slotIndex);
-			if (pattern)
+			const juce::ScopedLock sl(midiMappingLock);
+			if (mappingStateDirty.exchange(false))
 			{
-				auto slotNode = juce::ValueTree("Slot" + juce::String(slotIndex));
+				// Tagged by target id, so adding a target does not shift older mappings.
+				juce::MemoryOutputStream mappingData(mappingStateCache, false);
+				mappingData.writeByte((char)midiTargets.size());
+				for (const auto& info : midiTargets)
+				{
+					mappingData.writeString(info.id);
+					mappingData.writeByte((char)info.numSlots);
+					for (int slot = 0; slot < info.numSlots; ++slot)
+					{
+						const auto& mapping = midiMappings[(size_t)getMappingIndex(info.target, slot)];
+						mappingData.writeShort((short)mapping.ccNumber);
+						mappingData.writeByte((char)mapping.channel);
+						mappingData.writeByte((char)((mapping.isNote ? 1 : 0) | (mapping.isProgramChange ? 2 : 0)));
+					}
+				}
+			}
+			stream.write(mappingStateCache.getData(), mappingStateCache.getSize());
+		}
 
-				slotNode.setProperty("name", pattern->getName(), nullptr);
-				slotNode.setProperty("swing", pattern->getSwing(), nullptr);
-				slotNode.setProperty("length", pattern->getLength(), nullptr);
+		uint32_t dirtySlots = getPatternEngine().consumeStateDirtySlots();
+		for (int i = 0; i < 8; ++i)
+		{
+			if ((dirtySlots & (1u << i)) == 0)
+				continue;
 
-				auto ts = pattern->getTimeSignature();
-				slotNode.setProperty("timeSignatureNum", ts.numerator, nullptr);
-				slotNode.setProperty("timeSignatureDenom", ts.denominator, nullptr);
+			slotStateCache[i].reset();
+			if (auto pattern = getPatternEngine().copySlot(i))
+			{
+				juce::MemoryOutputStream slotData(slotStateCache[i], false);
+				PatternSerializer::write(*pattern, slotData);
+			}
+		}
 
-				for (int trackIndex = 0; trackIndex < pattern->getNumTracks(); ++trackIndex)
-				{
-					auto trackNode = juce::ValueTree("Track" + juce::String(trackIndex));
-					const auto& track = pattern->getTrack(trackIndex);
+		juce::uint8 slotMask = 0;
+		for (int i = 0; i < 8; ++i)
+			if (slotStateCache[i].getSize() > 0)
+				slotMask |= (juce::uint8)(1u << i);
+		stream.writeByte((char)slotMask);
 
-					trackNode.setProperty("name", track.getName(), nullptr);
-					trackNode.setProperty("midiNote", track.getMidiNote(), nullptr);
+		for (const auto& slotData : slotStateCache)
+		{
+			if (slotData.getSize() == 0)
+				continue;
 
-					for (int stepIndex = 0; stepIndex < track.getLength(); ++stepIndex)
-					{
-						const auto* step = track.getStep(stepIndex);
+			stream.writeInt((int)slotData.getSize());
+			stream.write(slotData.getData(), slotData.getSize());
+		}
+	}
 
-						if (step) {
-							if (step->isActive())
-							{
-								auto stepNode = juce::ValueTree("Step" + juce::String(stepIndex));
-								stepNode.setProperty("active", step->isActive(), nullptr);
-								stepNode.setProperty("velocity", step->getVelocity(), nullptr);
-								stepNode.setProperty("microTiming", step->getMicroTiming(), nullptr);
-								stepNode.setProperty("probability", step->getProbability(), nullptr);
+	bool BeatCrafterProcessor::readBinaryState(const void* data, int sizeInBytes)
+	{
+		// Everything is parsed into locals first; a truncated or foreign blob
+		// returns false before any parameter, slot or mapping is touched.
+		constexpr int headerBytes = 4 + 2 + 4 + 4 + 1 + 1;
+		constexpr int slotStyleBytes = 8 * (1 + 4);
+		constexpr int mappingEntryBytes = 2 + 1 + 1;
+		// Before state version 4 the mappings were a flat list in midiTargets order.
+		constexpr int legacyNumMidiMappings = 12;
+
+		juce::MemoryInputStream stream(data, (size_t)juce::jmax(0, sizeInBytes), false);
+		auto hasBytes = [&stream](juce::int64 numBytes) { return stream.getNumBytesRemaining() >= numBytes; };
+
+		if (!hasBytes(headerBytes) || (juce::uint32)stream.readInt() != stateMagic)
+			return false;
 
-								trackNode.addChild(stepNode, -1, nullptr);
-							}
-						}
-					}
+		int version = stream.readShort();
+		if (version < 1 || version > stateVersion)
+			return false;
 
-					slotNode.addChild(trackNode, -1, nullptr);
-				}
+		float intensity = stream.readFloat();
+		float liveJamIntensity = stream.readFloat();
+		int activeSlot = juce::jlimit(0, 7, (int)(juce::uint8)stream.readByte());
+		auto flags = (juce::uint8)stream.readByte();
 
-				state.addChild(slotNode, -1, nullptr);
-			}
+		if (!hasBytes(slotStyleBytes))
+			return false;
+
+		std::array<StyleType, 8> styles;
+		std::array<uint32_t, 8> seeds;
+		for (int i = 0; i < 8; ++i)
+		{
+			styles[i] = (StyleType)juce::jlimit(0, (int)StyleType::Punk, (int)(juce::uint8)stream.readByte());
+			seeds[i] = (uint32_t)stream.readInt();
 		}
 
-		if (intensityMapping.isValid())
+		std::array<juce::String, 8> packStyleNames;
+		if (version >= 3)
 		{
-			state.setProperty("intensityMidiCC", intensityMapping.ccNumber, nullptr);
-			state.setProperty("intensityMidiChannel", intensityMapping.channel, nullptr);
-			state.setProperty("intensityMidiIsNote", intensityMapping.isNote, nullptr);
+			for (auto& name : packStyleNames)
+			{
+				if (stream.isExhausted())
+					return false;
+				name = stream.readString();
+			}
 		}
 
-		if (liveJamIntensityMapping.isValid())
+		std::array<MidiMapping, numMidiMappings> mappings;
+		auto readMapping = [&stream](MidiMapping* mapping)
+			{
+				MidiMapping read;
+				read.ccNumber = stream.readShort();
+				read.channel = (juce::int8)stream.readByte();
+				auto mappingFlags = (juce::uint8)stream.readByte();
+				read.isNote = (mappingFlags & 1) != 0;
+				read.isProgramChange = (mappingFlags & 2) != 0;
+				if (mapping != nullptr)
+					*mapping = read;
+			};
+
+		if (version >= 4)
 		{
-			state.setProperty("liveJamIntensityMidiCC", liveJamIntensityMapping.ccNumber, nullptr);
-			state.setProperty("liveJamIntensityMidiChannel", liveJamIntensityMapping.channel, nullptr);
-			state.setProperty("liveJamIntensityMidiIsNote", liveJamIntensityMapping.isNote, nullptr);
+			if (!hasBytes(1))
+				return false;
+
+			// Unknown ids and extra slots are skipped; targets missing from the state stay unmapped.
+			int numTargets = (juce::uint8)stream.readByte();
+			for (int t = 0; t < numTargets; ++t)
+			{
+				if (stream.isExhausted())
+					return false;
+
+				auto id = stream.readString();
+				if (!hasBytes(1))
+					return false;
+				int numSlots = (juce::uint8)stream.readByte();
+				if (!hasBytes((juce::int64)numSlots * mappingEntryBytes))
+					return false;
+
+				const MidiTargetInfo* target = nullptr;
+				for (const auto& info : midiTargets)
+					if (id == info.id)
+						target = &info;
+
+				for (int slot = 0; slot < numSlots; ++slot)
+				{
+					int index = target != nullptr ? getMappingIndex(target->target, slot) : -1;
+					readMapping(index >= 0 ? &mappings[(size_t)index] : nullptr);
+				}
+			}
 		}
-		if (surpriseMeMapping.isValid())
+		else
 		{
-			state.setProperty("surpriseMeMidiCC", surpriseMeMapping.ccNumber, nullptr);
-			state.setProperty("surpriseMeMidiChannel", surpriseMeMapping.channel, nullptr);
-			state.setProperty("surpriseMeMidiIsNote", surpriseMeMapping.isNote, nullptr);
+			if (!hasBytes(legacyNumMidiMappings * mappingEntryBytes))
+				return false;
+
+			for (int i = 0; i < legacyNumMidiMappings; ++i)
+				readMapping(i < numMidiMappings ? &mappings[(size_t)i] : nullptr);
 		}
-		if (tripletModeMapping.isValid())
+
+		if (!hasBytes(1))
+			return false;
+
+		auto slotMask = (juce::uint8)stream.readByte();
+		std::array<std::unique_ptr<Pattern>, 8> patterns;
+		for (int i = 0; i < 8; ++i)
 		{
-			state.setProperty("tripletModeMidiCC", tripletModeMapping.ccNumber, nullptr);
-			state.setProperty("tripletModeMidiChannel", tripletModeMapping.channel, nullptr);
-			state.setProperty("tripletModeMidiIsNote", tripletModeMapping.isNote, nullptr);
+			if ((slotMask & (1u << i)) == 0)
+				continue;
+
+			if (!hasBytes(4))
+				return false;
+
+			int blobSize = stream.readInt();
+			if (blobSize <= 0 || blobSize > stream.getNumBytesRemaining())
+				return false;
+
+			juce::MemoryInputStream slotStream(static_cast<const char*>(data) + stream.getPosition(),
+				(size_t)blobSize, false);
+			// Before state version 4 pattern blobs carried no format byte: state 1
+			// wrote pattern format 1, states 2 and 3 wrote format 2.
+			patterns[i] = version >= 4 ? PatternSerializer::read(slotStream)
+				: PatternSerializer::readUnversioned(slotStream, version == 1 ? 1 : 2);
+			if (!patterns[i])
+				return false;
+			stream.skipNextBytes(blobSize);
 		}
 
+		intensityParam->setValueNotifyingHost(intensity);
+		liveJamIntensityParam->setValueNotifyingHost(liveJamIntensity);
+		liveJamModeState = (flags & stateLiveJamMode) != 0;
+		patternEngine.postCommand({ PatternEngine::CommandType::SetLiveJamMode, -1, 0.0f, liveJamModeState });
+		bool surpriseMeActive = (flags & stateSurpriseMe) != 0;
+		surpriseMeParam->setValueNotifyingHost(surpriseMeActive ? 1.0f : 0.0f);
+		bool tripletActive = (flags & stateTripletMode) != 0;
+		tripletModeParam->setValueNotifyingHost(tripletActive ? 1.0f : 0.0f);
+
 		for (int i = 0; i < 8; ++i)
 		{
-			if (slotMappings[i].isValid())
-			{
-				juce::String ccProp = "slot" + juce::String(i) + "MidiCC";
-				juce::String channelProp = "slot" + juce::String(i) + "MidiChannel";
-				juce::String isNoteProp = "slot" + juce::String(i) + "MidiIsNote";
-				juce::String isProgramChangeProp = "slot" + juce::String(i) + "MidiIsProgramChange";
-
-				state.setProperty(ccProp, slotMappings[i].ccNumber, nullptr);
-				state.setProperty(channelProp, slotMappings[i].channel, nullptr);
-				state.setProperty(isNoteProp, slotMappings[i].isNote, nullptr);
-				state.setProperty(isProgramChangeProp, slotMappings[i].isProgramChange, nullptr);
-			}
+			if (packStyleNames[i].isEmpty() || !setSlotStyle(i, packStyleNames[i]))
+				getPatternEngine().setSlotStyle(i, styles[i]);
+			getPatternEngine().setSlotSeed(i, seeds[i]);
+			if (patterns[i])
+				getPatternEngine().loadPatternToSlot(std::move(patterns[i]), i);
+			else
+				getPatternEngine().resetSlot(i);
 		}
 
-		juce::MemoryOutputStream stream(destData, false);
-		state.writeToStream(stream);
+		{
+			const juce::ScopedLock sl(midiMappingLock);
+			midiMappings = mappings;
+		}
+		rebuildMidiDispatch();
+
+		getPatternEngine().postCommand({ PatternEngine::CommandType::SwitchSlot, activeSlot,
+			intensityParam->get(), true });
+
+		updateEditorFromState();
+		return true;
 	}
 
 	void BeatCrafterProcessor::setStateInformation(const void* data, int sizeInBytes)
 	{
+		if (readBinaryState(data, sizeInBytes))
+			return;
+
 		auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
 		if (tree.isValid())
+			readLegacyState(tree);
+		else
+			setupDefaultMidiMappings();
+	}
+
+	void BeatCrafterProcessor::readLegacyState(const juce::ValueTree& tree)
+	{
+		intensityParam->setValueNotifyingHost(tree.getProperty("intensity", 0.5f));
+		liveJamModeState = tree.getProperty("liveJamMode", false);
+		patternEngine.postCommand({ PatternEngine::CommandType::SetLiveJamMode, -1, 0.0f, liveJamModeState });
+		liveJamIntensityParam->setValueNotifyingHost(tree.getProperty("liveJamIntensity", 0.5f));
+		bool surpriseMeActive = tree.getProperty("surpriseMe", false);
+		surpriseMeParam->setValueNotifyingHost(surpriseMeActive ? 1.0f : 0.0f);
+		bool tripletActive = tree.getProperty("tripletMode", false);
+		tripletModeParam->setValueNotifyingHost(tripletActive ? 1.0f : 0.0f);
+
+		for (int slotIndex = 0; slotIndex < 8; ++slotIndex)
 		{
-			intensityParam->setValueNotifyingHost(tree.getProperty("intensity", 0.5f));
-			liveJamModeState = tree.getProperty("liveJamMode", false);
-			patternEngine.setLiveJamMode(liveJamModeState);
-			liveJamIntensityParam->setValueNotifyingHost(tree.getProperty("liveJamIntensity", 0.5f));
-			bool surpriseMeActive = tree.getProperty("surpriseMe", false);
-			surpriseMeParam->setValueNotifyingHost(surpriseMeActive ? 1.0f : 0.0f);
-			patternEngine.perfParams.surpriseMeEnabled = surpriseMeActive;
-			bool tripletActive = tree.getProperty("tripletMode", false);
-			tripletModeParam->setValueNotifyingHost(tripletActive ? 1.0f : 0.0f);
-			patternEngine.perfParams.tripletMode = tripletActive;
-
-			for (int slotIndex = 0; slotIndex < 8; ++slotIndex)
+			auto slotNode = tree.getChildWithName("Slot" + juce::String(slotIndex));
+			if (slotNode.isValid())
 			{
-				auto slotNode = tree.getChildWithName("Slot" + juce::String(slotIndex));
-				if (slotNode.isValid())
-				{
-					auto restoredPattern = std::make_unique<Pattern>(
-						slotNode.getProperty("name", "Pattern " + juce::String(slotIndex + 1)));
+				auto restoredPattern = std::make_unique<Pattern>(
+					slotNode.getProperty("name", "Pattern " + juce::String(slotIndex + 1)));
 
-					restoredPattern->setSwing(slotNode.getProperty("swing", 0.0f));
-					int patternLength = slotNode.getProperty("length", 16);
-					restoredPattern->setLength(patternLength);
+				restoredPattern->setSwing(slotNode.getProperty("swing", 0.0f));
+				TimeSignature ts;
+				ts.numerator = slotNode.getProperty("timeSignatureNum", 4);
+				ts.denominator = slotNode.getProperty("timeSignatureDenom", 4);
+				restoredPattern->setTimeSignature(ts);
 
-					TimeSignature ts;
-					ts.numerator = slotNode.getProperty("timeSignatureNum", 4);
-					ts.denominator = slotNode.getProperty("timeSignatureDenom", 4);
-					restoredPattern->setTimeSignature(ts);
+				int patternLength = slotNode.getProperty("length", 16);
+				restoredPattern->setLength(patternLength);
 
-					for (int trackIndex = 0; trackIndex < restoredPattern->getNumTracks(); ++trackIndex)
+				for (int trackIndex = 0; trackIndex < restoredPattern->getNumTracks(); ++trackIndex)
+				{
+					auto trackNode = slotNode.getChildWithName("Track" + juce::String(trackIndex));
+					if (trackNode.isValid())
 					{
-						auto trackNode = slotNode.getChildWithName("Track" + juce::String(trackIndex));
-						if (trackNode.isValid())
-						{
-							auto& track = restoredPattern->getTrack(trackIndex);
+						auto& track = restoredPattern->getTrack(trackIndex);
 
-							track.setName(trackNode.getProperty("name", track.getName()));
-							track.setMidiNote(trackNode.getProperty("midiNote", track.getMidiNote()));
+						track.setName(trackNode.getProperty("name", track.getName()));
+						track.setMidiNote(trackNode.getProperty("midiNote", track.getMidiNote()));
 
-							track.clear();
+						track.clear();
 
-							for (int childIndex = 0; childIndex < trackNode.getNumChildren(); ++childIndex)
-							{
-								auto stepNode = trackNode.getChild(childIndex);
-								juce::String stepName = stepNode.getType().toString();
+						for (int childIndex = 0; childIndex < trackNode.getNumChildren(); ++childIndex)
+						{
+							auto stepNode = trackNode.getChild(childIndex);
+							juce::String stepName = stepNode.getType().toString();
 
-								if (stepName.startsWith("Step"))
+							if (stepName.startsWith("Step"))
+							{
+								int stepIndex = stepName.substring(4).getIntValue();
+								if (stepIndex >= 0 && stepIndex < track.getLength())
 								{
-									int stepIndex = stepName.substring(4).getIntValue();
-									if (stepIndex >= 0 && stepIndex < track.getLength())
-									{
-										auto& step = track.getStep(stepIndex);
-
-										step.setActive(stepNode.getProperty("active", false));
-										step.setVelocity(stepNode.getProperty("velocity", 0.8f));
-										step.setMicroTiming(stepNode.getProperty("microTiming", 0.0f));
-										step.setProbability(stepNode.getProperty("probability", 1.0f));
-									}
+									auto step = track.getStep(stepIndex);
+
+									step.setActive(stepNode.getProperty("active", false));
+									step.setVelocity(stepNode.getProperty("velocity", 0.8f));
+									step.setMicroTiming(stepNode.getProperty("microTiming", 0.0f));
+									step.setProbability(stepNode.getProperty("probability", 1.0f));
 								}
 							}
 						}
 					}
-					getPatternEngine().loadPatternToSlot(std::move(restoredPattern), slotIndex);
 				}
+				getPatternEngine().loadPatternToSlot(std::move(restoredPattern), slotIndex);
 			}
-			bool hasSavedMidiMappings = false;
-			if (tree.hasProperty("intensityMidiCC"))
-			{
-				intensityMapping.ccNumber = tree.getProperty("intensityMidiCC", -1);
-				intensityMapping.channel = tree.getProperty("intensityMidiChannel", -1);
-				intensityMapping.isNote = tree.getProperty("intensityMidiIsNote", false);
-				hasSavedMidiMappings = true;
-			}
-
-			if (tree.hasProperty("liveJamIntensityMidiCC"))
-			{
-				liveJamIntensityMapping.ccNumber = tree.getProperty("liveJamIntensityMidiCC", -1);
-				liveJamIntensityMapping.channel = tree.getProperty("liveJamIntensityMidiChannel", -1);
-				liveJamIntensityMapping.isNote = tree.getProperty("liveJamIntensityMidiIsNote", false);
-				hasSavedMidiMappings = true;
-			}
-
-			if (tree.hasProperty("surpriseMeMidiCC"))
-			{
-				surpriseMeMapping.ccNumber = tree.getProperty("surpriseMeMidiCC", -1);
-				surpriseMeMapping.channel = tree.getProperty("surpriseMeMidiChannel", -1);
-				surpriseMeMapping.isNote = tree.getProperty("surpriseMeMidiIsNote", false);
-			}
-
-			if (tree.hasProperty("tripletModeMidiCC"))
-			{
-				tripletModeMapping.ccNumber = tree.getProperty("tripletModeMidiCC", -1);
-				tripletModeMapping.channel = tree.getProperty("tripletModeMidiChannel", -1);
-				tripletModeMapping.isNote = tree.getProperty("tripletModeMidiIsNote", false);
-			}
-
-			for (int i = 0; i < 8; ++i)
+		}
+		auto readLegacyMapping = [this, &tree](const juce::String& prefix, MidiTarget target, int slot)
 			{
-				juce::String ccProp = "slot" + juce::String(i) + "MidiCC";
-				juce::String channelProp = "slot" + juce::String(i) + "MidiChannel";
-				juce::String isNoteProp = "slot" + juce::String(i) + "MidiIsNote";
-				juce::String isProgramChangeProp = "slot" + juce::String(i) + "MidiIsProgramChange";
+				if (!tree.hasProperty(prefix + "MidiCC"))
+					return false;
+
+				const juce::ScopedLock sl(midiMappingLock);
+				auto& mapping = midiMappings[(size_t)getMappingIndex(target, slot)];
+				mapping.ccNumber = tree.getProperty(prefix + "MidiCC", -1);
+				mapping.channel = tree.getProperty(prefix + "MidiChannel", -1);
+				mapping.isNote = tree.getProperty(prefix + "MidiIsNote", false);
+				mapping.isProgramChange = tree.getProperty(prefix + "MidiIsProgramChange", false);
+				return true;
+			};
 
-				if (tree.hasProperty(ccProp))
-				{
-					slotMappings[i].ccNumber = tree.getProperty(ccProp, -1);
-					slotMappings[i].channel = tree.getProperty(channelProp, -1);
-					slotMappings[i].isNote = tree.getProperty(isNoteProp, false);
-					slotMappings[i].isProgramChange = tree.getProperty(isProgramChangeProp, false);
-					hasSavedMidiMappings = true;
-				}
-			}
-			if (!hasSavedMidiMappings)
-			{
-				setupDefaultMidiMappings();
-			}
-			int activeSlot = tree.getProperty("activeSlot", 0);
-			getPatternEngine().switchToSlot(activeSlot, true, intensityParam->get());
+		// Legacy properties are named after the target id, with the slot appended for multi-slot targets.
+		bool hasSavedMidiMappings = false;
+		for (const auto& info : midiTargets)
+			for (int slot = 0; slot < info.numSlots; ++slot)
+				hasSavedMidiMappings |= readLegacyMapping(info.numSlots > 1 ? info.id + juce::String(slot) : juce::String(info.id),
+					info.target, slot);
 
-			updateEditorFromState();
-		}
-		else
+		if (!hasSavedMidiMappings)
 		{
 			setupDefaultMidiMappings();
 		}
+		rebuildMidiDispatch();
+		int activeSlot = tree.getProperty("activeSlot", 0);
+		getPatternEngine().postCommand({ PatternEngine::CommandType::SwitchSlot, activeSlot,
+			intensityParam->get(), true });
+
+		updateEditorFromState();
 	}
 
-	void BeatCrafterProcessor::startMidiLearn(int targetType, int targetSlot)
+	void BeatCrafterProcessor::startMidiLearn(MidiTarget target, int slot)
 	{
-		midiLearnMode = true;
-		midiLearnTargetType = targetType;
-		midiLearnTargetSlot = targetSlot;
+		learnedMidiMapping = 0;
+		midiLearnIndex = getMappingIndex(target, slot);
 	}
 
 	void BeatCrafterProcessor::stopMidiLearn()
 	{
-		midiLearnMode = false;
-		midiLearnTargetType = -1;
-		midiLearnTargetSlot = -1;
+		midiLearnIndex = -1;
+	}
 
-		juce::MessageManager::callAsync([this]()
-			{
-				if (auto* editor = dynamic_cast<BeatCrafterEditor*>(getActiveEditor()))
-					editor->updateMidiLearnButtons();
-			});
+	bool BeatCrafterProcessor::isMidiLearning(MidiTarget target, int slot) const
+	{
+		int index = getMappingIndex(target, slot);
+		return index >= 0 && midiLearnIndex.load() == index;
 	}
 
-	void BeatCrafterProcessor::clearMidiMapping(int targetType, int targetSlot)
+	void BeatCrafterProcessor::clearMidiMapping(MidiTarget target, int slot)
 	{
-		if (targetType == 0)
-		{
-			intensityMapping = MidiMapping{};
-		}
-		else if (targetType >= 1 && targetType <= 8 && targetSlot >= 0 && targetSlot < 8)
-		{
-			slotMappings[targetSlot] = MidiMapping{};
-		}
-		else if (targetType == 2)
+		int index = getMappingIndex(target, slot);
+		if (index < 0)
+			return;
+
 		{
-			liveJamIntensityMapping = MidiMapping{};
+			const juce::ScopedLock sl(midiMappingLock);
+			midiMappings[(size_t)index] = MidiMapping{};
 		}
-		else if (targetType == 3)
-			surpriseMeMapping = {};
-		else if (targetType == 4)
-			tripletModeMapping = {};
+		rebuildMidiDispatch();
 	}
 
-	bool BeatCrafterProcessor::hasMidiMapping(int targetType, int targetSlot) const
+	bool BeatCrafterProcessor::hasMidiMapping(MidiTarget target, int slot) const
 	{
-		if (targetType == 0)
-		{
-			return intensityMapping.isValid();
-		}
-		else if (targetType >= 1 && targetType <= 8 && targetSlot >= 0 && targetSlot < 8)
-		{
-			return slotMappings[targetSlot].isValid();
-		}
-		else if (targetType == 2)
-		{
-			return liveJamIntensityMapping.isValid();
-		}
-		else if (targetType == 3)
-			return surpriseMeMapping.isValid();
-		else if (targetType == 4)
-			return tripletModeMapping.isValid();
-		return false;
+		int index = getMappingIndex(target, slot);
+		return index >= 0 && midiMappings[(size_t)index].isValid();
 	}
 
-	juce::String BeatCrafterProcessor::getMidiMappingDescription(int targetType, int targetSlot) const
+	juce::String BeatCrafterProcessor::getMidiMappingDescription(MidiTarget target, int slot) const
 	{
 		MidiMapping mapping;
-
-		if (targetType == 0)
-			mapping = intensityMapping;
-		else if (targetType == 1 && targetSlot >= 0 && targetSlot < 8)
-			mapping = slotMappings[targetSlot];
-		else if (targetType == 2)
-			mapping = liveJamIntensityMapping;
-		else if (targetType == 3)
-			mapping = surpriseMeMapping;
-		else if (targetType == 4)
-			mapping = tripletModeMapping;
+		int index = getMappingIndex(target, slot);
+		if (index >= 0)
+			mapping = midiMappings[(size_t)index];
 
 		if (mapping.isValid())
 		{
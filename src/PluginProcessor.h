@@ -2,6 +2,9 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_core/juce_core.h>
 #include "Core/PatternEngine.h"
+#include "Core/PatternSerializer.h"
+#include "Core/StyleLibrary.h"
+#include "Core/TripleBuffer.h"
 
 namespace BeatCrafter
 {
@@ -25,14 +28,8 @@ namespace BeatCrafter
 
 		void processMidiNoteOn(int noteNumber, int channel, int velocity);
 
-		void learnForNoteOn(int noteNumber, int channel);
-
-		void learnForPC(int programNumber, int channel);
-
 		void processForCC(int ccNumber, int channel, int value);
 
-		void learnByType(int ccNumber, int channel);
-
 		juce::AudioProcessorEditor* createEditor() override;
 		bool hasEditor() const override { return true; }
 
@@ -53,6 +50,11 @@ namespace BeatCrafter
 		void setStateInformation(const void* data, int sizeInBytes) override;
 
 		PatternEngine& getPatternEngine() { return patternEngine; }
+		const StyleLibrary& getStyleLibrary() const { return styleLibrary; }
+		bool setSlotStyle(int slot, const juce::String& packStyleName);
+		// Message thread: restyle a slot and let the render thread regenerate it.
+		void changeSlotStyle(int slot, StyleType style);
+		bool changeSlotStyle(int slot, const juce::String& packStyleName);
 
 		juce::AudioParameterFloat* intensityParam;
 		juce::AudioParameterChoice* styleParam;
@@ -61,26 +63,95 @@ namespace BeatCrafter
 		std::array<juce::AudioParameterChoice*, 8> slotStyleParams;
 		juce::AudioParameterFloat* liveJamIntensityParam = nullptr;
 
-		void startMidiLearn(int targetType, int targetSlot = -1);
-		void stopMidiLearn();
-		bool isMidiLearning() const { return midiLearnMode; }
-		int getMidiLearnTarget() const { return midiLearnTargetType; }
-		int getMidiLearnSlot() const { return midiLearnTargetSlot; }
+		enum class MidiTarget : uint8_t
+		{
+			None,
+			Intensity,
+			LiveJamIntensity,
+			SurpriseMe,
+			TripletMode,
+			Slot
+		};
+
+		enum class MidiTargetKind : uint8_t
+		{
+			Continuous,
+			Toggle,
+			Trigger
+		};
+
+		struct MidiTargetInfo
+		{
+			MidiTarget target;
+			const char* id;
+			MidiTargetKind kind;
+			int numSlots;
+		};
 
-		void clearMidiMapping(int targetType, int targetSlot = -1);
-		bool hasMidiMapping(int targetType, int targetSlot = -1) const;
-		juce::String getMidiMappingDescription(int targetType, int targetSlot = -1) const;
+		// Every mappable control, in mapping storage order. Dispatch, MIDI learn
+		// and the saved state all walk this table; ids are stored in the state.
+		static constexpr std::array<MidiTargetInfo, 5> midiTargets{ {
+			{ MidiTarget::Intensity, "intensity", MidiTargetKind::Continuous, 1 },
+			{ MidiTarget::LiveJamIntensity, "liveJamIntensity", MidiTargetKind::Continuous, 1 },
+			{ MidiTarget::SurpriseMe, "surpriseMe", MidiTargetKind::Toggle, 1 },
+			{ MidiTarget::TripletMode, "tripletMode", MidiTargetKind::Toggle, 1 },
+			{ MidiTarget::Slot, "slot", MidiTargetKind::Trigger, 8 }
+		} };
+
+		static constexpr int numMidiMappings = []()
+			{
+				int count = 0;
+				for (const auto& info : midiTargets)
+					count += info.numSlots;
+				return count;
+			}();
+		// Single-slot targets take slot -1 (or 0); -1 when the target has no such slot.
+		static int getMappingIndex(MidiTarget target, int slot = -1);
+
+		void startMidiLearn(MidiTarget target, int slot = -1);
+		void stopMidiLearn();
+		bool isMidiLearning() const { return midiLearnIndex.load() >= 0; }
+		bool isMidiLearning(MidiTarget target, int slot = -1) const;
+		// Message thread: stores the mapping captured by the audio thread during learn.
+		void commitLearnedMidiMapping();
+
+		void clearMidiMapping(MidiTarget target, int slot = -1);
+		bool hasMidiMapping(MidiTarget target, int slot = -1) const;
+		juce::String getMidiMappingDescription(MidiTarget target, int slot = -1) const;
 		void setupDefaultMidiMappings();
 		void setLiveJamMode(bool enabled);
 		bool getLiveJamMode() const { return liveJamModeState; }
 
+		struct EditorMailbox
+		{
+			enum Event : uint32_t
+			{
+				slotSwitched = 1u << 0,
+				intensityChanged = 1u << 1,
+				liveJamIntensityChanged = 1u << 2,
+				controlsChanged = 1u << 3,
+				midiLearned = 1u << 4
+			};
+
+			std::atomic<uint32_t> pendingEvents{ 0 };
+			std::atomic<int> switchedSlot{ -1 };
+			std::atomic<float> intensity{ 0.0f };
+			std::atomic<float> liveJamIntensity{ 0.0f };
+			std::atomic<bool> tripletMode{ false };
+
+			void post(uint32_t events) { pendingEvents.fetch_or(events, std::memory_order_release); }
+			uint32_t collect() { return pendingEvents.exchange(0, std::memory_order_acquire); }
+		};
+
+		EditorMailbox editorMailbox;
+
 	private:
+		StyleLibrary styleLibrary;
 		PatternEngine patternEngine;
 		double currentSampleRate = 44100.0;
 
-		bool midiLearnMode = false;
-		int midiLearnTargetType = -1;
-		int midiLearnTargetSlot = -1;
+		std::atomic<int> midiLearnIndex{ -1 };
+		std::atomic<uint32_t> learnedMidiMapping{ 0 };
 
 		std::atomic<int> pendingPatternGeneration{ -1 };
 		std::atomic<int> pendingPatternStyle{ -1 };
@@ -94,11 +165,48 @@ namespace BeatCrafter
 			bool isValid() const { return ccNumber >= 0 && channel >= 0; }
 		};
 
-		MidiMapping intensityMapping;
-		MidiMapping liveJamIntensityMapping;
-		MidiMapping surpriseMeMapping;
-		MidiMapping tripletModeMapping;
-		std::array<MidiMapping, 8> slotMappings;
+		// Written on the message thread only; the audio thread sees them through midiDispatch.
+		std::array<MidiMapping, numMidiMappings> midiMappings;
+		juce::CriticalSection midiMappingLock;
+
+		static constexpr juce::uint32 stateMagic = 0x54534342; // "BCST"
+		static constexpr int stateVersion = 4;
+		enum StateFlags : juce::uint8
+		{
+			stateLiveJamMode = 1 << 0,
+			stateSurpriseMe = 1 << 1,
+			stateTripletMode = 1 << 2
+		};
+
+		std::array<juce::MemoryBlock, 8> slotStateCache;
+		juce::MemoryBlock mappingStateCache;
+		std::atomic<bool> mappingStateDirty{ true };
+
+		bool readBinaryState(const void* data, int sizeInBytes);
+		void readLegacyState(const juce::ValueTree& tree);
+
+		struct MidiAction
+		{
+			MidiTarget target = MidiTarget::None;
+			int8_t slot = -1;
+		};
+
+		enum class MidiSource
+		{
+			Controller,
+			Note,
+			ProgramChange
+		};
+
+		using MidiDispatchTable = std::array<MidiAction, 3 * 16 * 128>;
+
+		TripleBuffer<MidiDispatchTable> midiDispatch;
+
+		void rebuildMidiDispatch();
+		const MidiAction& lookupMidiAction(MidiSource source, int number, int channel) const;
+		void learnMidiSource(MidiSource source, int number, int channel);
+		static MidiAction getMappingAction(int mappingIndex);
+		static const MidiTargetInfo* findMidiTarget(MidiTarget target);
 
 		bool liveJamMode = false;
 		juce::Random liveJamRandom;
@@ -0,0 +1,117 @@
+#include "Core/RandomState.h"
+#include "Core/StepKernels.h"
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	using namespace BeatCrafter;
+
+	struct KernelLanes
+	{
+		static constexpr int capacity = 131;
+
+		std::array<std::uint32_t, capacity> active;
+		std::array<std::uint32_t, capacity> hits;
+		std::array<float, capacity> velocity, probability, offsets, draws, chances;
+
+		// Out-of-range velocities and probabilities exercise the clamps, and
+		// arbitrary non-zero active words the "0 or non-zero" contract.
+		void randomise(RandomState& rng)
+		{
+			for (size_t i = 0; i < (size_t)capacity; ++i)
+			{
+				active[i] = rng.nextChance(0.5f) ? (rng.nextUInt() | 1u) : 0u;
+				hits[i] = rng.nextChance(0.3f) ? (rng.nextUInt() | 1u) : 0u;
+				velocity[i] = rng.nextFloat(-0.5f, 1.5f);
+				probability[i] = rng.nextChance(0.3f) ? 1.0f : rng.nextFloat(-0.5f, 1.5f);
+				offsets[i] = rng.nextFloat(-0.5f, 0.5f);
+				draws[i] = rng.nextFloat();
+				chances[i] = rng.nextFloat(0.0f, 0.5f);
+			}
+		}
+
+		bool operator==(const KernelLanes& other) const
+		{
+			return std::memcmp(this, &other, sizeof(KernelLanes)) == 0;
+		}
+	};
+
+	enum class Kernel { ScaleActive, Humanize, MergeHits };
+	constexpr const char* kernelNames[] = { "scaleActive", "humanize", "mergeHits" };
+
+	// Runs one kernel through the default entry point and the scalar reference
+	// on copies of the same lanes, starting at offset so the vector loops also
+	// see unaligned pointers.
+	bool matchesReference(const KernelLanes& lanes, Kernel kernel, int offset, int count, float gainA, float gainB)
+	{
+		auto vector = lanes;
+		auto reference = lanes;
+		auto run = [&](KernelLanes& l, bool scalar)
+			{
+				auto* active = l.active.data() + offset;
+				auto* velocity = l.velocity.data() + offset;
+				auto* probability = l.probability.data() + offset;
+				switch (kernel)
+				{
+				case Kernel::ScaleActive:
+					(scalar ? StepKernels::Scalar::scaleActive : StepKernels::scaleActive)(
+						active, velocity, probability, count, gainA, gainB);
+					break;
+				case Kernel::Humanize:
+					(scalar ? StepKernels::Scalar::humanize : StepKernels::humanize)(active, velocity,
+						l.offsets.data() + offset, l.draws.data() + offset, l.chances.data() + offset, count, gainA * 0.25f);
+					break;
+				case Kernel::MergeHits:
+					(scalar ? StepKernels::Scalar::mergeHits : StepKernels::mergeHits)(active, velocity, probability,
+						l.hits.data() + offset, l.offsets.data() + offset, l.draws.data() + offset, count);
+					break;
+				}
+			};
+
+		run(vector, false);
+		run(reference, true);
+		return vector == reference;
+	}
+}
+
+// Every StepKernels entry point must match its scalar reference bit for bit,
+// for every length up to the lane capacity (so every tail size) and on random
+// offsets and lengths.
+int main()
+{
+	RandomState rng(0x5eed);
+	int failures = 0;
+	KernelLanes lanes;
+
+	for (int k = 0; k < (int)std::size(kernelNames); ++k)
+	{
+		auto kernel = (Kernel)k;
+		int mismatches = 0;
+
+		for (int count = 0; count <= KernelLanes::capacity; ++count)
+		{
+			lanes.randomise(rng);
+			if (!matchesReference(lanes, kernel, 0, count, rng.nextFloat(0.0f, 2.0f), rng.nextFloat(0.0f, 2.0f)))
+				++mismatches;
+		}
+
+		for (int iteration = 0; iteration < 5000; ++iteration)
+		{
+			lanes.randomise(rng);
+			int offset = rng.nextInt(4);
+			int count = rng.nextInt(KernelLanes::capacity - offset + 1);
+			if (!matchesReference(lanes, kernel, offset, count, rng.nextFloat(0.0f, 2.0f), rng.nextFloat(0.0f, 2.0f)))
+				++mismatches;
+		}
+
+		std::printf("%s (%s): %d mismatches\n", kernelNames[k], StepKernels::getInstructionSet(), mismatches);
+		if (mismatches > 0)
+			++failures;
+	}
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+#include "Core/FeatureIndex.h"
+#include "Core/SeedExplorer.h"
+#include "Core/StyleLibrary.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace BeatCrafter;
+	using Clock = std::chrono::steady_clock;
+
+	enum class RankMode
+	{
+		None,
+		Density,
+		Similarity
+	};
+
+	struct ExploreOptions
+	{
+		std::vector<std::string> styleNames = {
+			"Rock", "Metal", "Jazz", "Funk", "Electronic", "HipHop", "Latin", "Punk"
+		};
+		std::uint32_t firstSeed = 1;
+		int numSeeds = 256;
+		std::vector<float> intensities = { 0.3f, 0.5f, 0.7f, 0.9f };
+		int numThreads = 0;
+		int top = 20;
+		bool json = false;
+		RankMode rank = RankMode::None;
+		float targetDensity = 0.0f;
+		std::string like;
+		std::vector<std::string> matchTracks;
+		std::vector<std::string> sparserTracks;
+		std::vector<std::string> denserTracks;
+		StyleLibrary styleLibrary;
+		SeedExplorer::Grid grid;
+	};
+
+	constexpr const char* builtInStyleNames[] = {
+		"Rock", "Metal", "Jazz", "Funk", "Electronic", "HipHop", "Latin", "Punk"
+	};
+
+	// Built-in names first, then styles from the loaded packs.
+	bool resolveStyle(const StyleLibrary& library, const std::string& name, StyleTable::StyleDefinition& definition)
+	{
+		for (size_t i = 0; i < std::size(builtInStyleNames); ++i)
+		{
+			if (juce::String(name).equalsIgnoreCase(builtInStyleNames[i]))
+			{
+				definition = StyleManager::getStyleDefinition((StyleType)i);
+				return true;
+			}
+		}
+
+		auto packStyle = library.find(juce::String(name));
+		if (packStyle)
+			definition = *packStyle;
+		return packStyle != nullptr;
+	}
+
+	std::vector<std::string> splitList(const std::string& text, char separator = ',')
+	{
+		std::vector<std::string> items;
+		size_t start = 0;
+		while (start <= text.size())
+		{
+			auto end = text.find(separator, start);
+			if (end == std::string::npos)
+				end = text.size();
+			if (end > start)
+				items.push_back(text.substr(start, end - start));
+			start = end + 1;
+		}
+		return items;
+	}
+
+	bool parseIntensities(const std::string& text, std::vector<float>& intensities)
+	{
+		intensities.clear();
+		for (const auto& item : splitList(text))
+			intensities.push_back(juce::jlimit(0.0f, 1.0f, (float)std::atof(item.c_str())));
+		return !intensities.empty();
+	}
+
+	bool parseMeter(const std::string& text, TimeSignature& meter)
+	{
+		auto parts = splitList(text, '/');
+		if (parts.size() != 2)
+			return false;
+
+		int numerator = std::atoi(parts[0].c_str());
+		int denominator = std::atoi(parts[1].c_str());
+		if (numerator < 1 || numerator > 32 || (denominator != 2 && denominator != 4 && denominator != 8 && denominator != 16))
+			return false;
+
+		meter.numerator = numerator;
+		meter.denominator = denominator;
+		return true;
+	}
+
+	bool parseResolution(const std::string& text, TimeSignature& meter)
+	{
+		int resolution = std::atoi(text.c_str());
+		if (resolution < 4 || resolution > 64 || resolution % 4 != 0)
+			return false;
+
+		meter.stepsPerQuarter = resolution / 4;
+		return true;
+	}
+
+	// Track index from its name in Pattern, ignoring case, spaces and dashes ("hihat", "Tom Low").
+	int findTrack(const std::string& name)
+	{
+		auto key = juce::String(name).removeCharacters(" -");
+		Pattern pattern;
+		for (int t = 0; t < pattern.getNumTracks(); ++t)
+			if (pattern.getTrack(t).getName().removeCharacters(" -").equalsIgnoreCase(key))
+				return t;
+		return -1;
+	}
+
+	bool parseTracks(const char* text, std::vector<std::string>& tracks)
+	{
+		tracks = splitList(text);
+		for (const auto& name : tracks)
+			if (findTrack(name) < 0)
+				return false;
+		return !tracks.empty();
+	}
+
+	// --match limits the onset comparison to the listed tracks; --sparser and
+	// --denser keep only candidates whose track density is below or above the
+	// reference's, e.g. --sparser=kick --match=snare.
+	FeatureIndex::Query makeQuery(const ExploreOptions& options, const PatternFeatures& reference)
+	{
+		FeatureIndex::Query query(reference);
+		if (!options.matchTracks.empty())
+		{
+			query.trackWeights.fill(0.0f);
+			for (const auto& name : options.matchTracks)
+				query.trackWeights[(size_t)findTrack(name)] = 1.0f;
+		}
+		for (const auto& name : options.sparserTracks)
+		{
+			auto t = (size_t)findTrack(name);
+			query.maxTrackDensity[t] = std::nextafter(reference.trackDensity[t], 0.0f);
+			query.trackWeights[t] = 0.0f;
+		}
+		for (const auto& name : options.denserTracks)
+		{
+			auto t = (size_t)findTrack(name);
+			query.minTrackDensity[t] = std::nextafter(reference.trackDensity[t], 1.0f);
+			query.trackWeights[t] = 0.0f;
+		}
+		return query;
+	}
+
+	// STYLE:SEED:INTENSITY names the reference candidate for --like.
+	bool findReference(const ExploreOptions& options, PatternFeatures& reference)
+	{
+		auto parts = splitList(options.like, ':');
+		if (parts.size() != 3)
+			return false;
+
+		SeedExplorer::Grid grid = options.grid;
+		grid.styles.resize(1);
+		if (!resolveStyle(options.styleLibrary, parts[0], grid.styles[0]))
+			return false;
+
+		SeedExplorer::Variation variation;
+		variation.seed = (std::uint32_t)std::strtoul(parts[1].c_str(), nullptr, 10);
+		variation.intensity = juce::jlimit(0.0f, 1.0f, (float)std::atof(parts[2].c_str()));
+		reference = PatternFeatures::fromPattern(SeedExplorer::generate(grid, variation));
+		return true;
+	}
+
+	void printUsage()
+	{
+		std::fprintf(stderr,
+			"usage: beatcrafter_explore [--styles=NAME,NAME,...] [--seeds=N] [--first-seed=N]\n"
+			"                           [--intensities=X,X,...] [--meter=N/D] [--resolution=16|32|12|24]\n"
+			"                           [--phrase=BARS] [--threads=N] [--style-pack=FILE ...]\n"
+			"                           [--target-density=X | --like=STYLE:SEED:INTENSITY]\n"
+			"                           [--match=TRACK,...] [--sparser=TRACK,...] [--denser=TRACK,...]\n"
+			"                           [--top=N] [--csv|--json]\n");
+	}
+
+	bool parseOptions(int argc, char* argv[], ExploreOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			auto value = [&](const char* name) -> const char*
+				{
+					auto prefix = std::string(name) + "=";
+					return arg.rfind(prefix, 0) == 0 ? argv[i] + prefix.size() : nullptr;
+				};
+
+			bool ok = true;
+			auto& grid = options.grid;
+			if (arg == "--csv")
+				options.json = false;
+			else if (arg == "--json")
+				options.json = true;
+			else if (auto v = value("--styles"))
+			{
+				options.styleNames = splitList(v);
+				ok = !options.styleNames.empty();
+			}
+			else if (auto v = value("--seeds"))
+				options.numSeeds = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--first-seed"))
+				options.firstSeed = (std::uint32_t)std::strtoul(v, nullptr, 10);
+			else if (auto v = value("--intensities"))
+				ok = parseIntensities(v, options.intensities);
+			else if (auto v = value("--meter"))
+				ok = parseMeter(v, grid.meter);
+			else if (auto v = value("--resolution"))
+				ok = parseResolution(v, grid.meter);
+			else if (auto v = value("--phrase"))
+				grid.numBars = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--threads"))
+				options.numThreads = std::atoi(v);
+			else if (auto v = value("--style-pack"))
+				ok = options.styleLibrary.addPack(juce::File::getCurrentWorkingDirectory().getChildFile(v));
+			else if (auto v = value("--target-density"))
+			{
+				options.rank = RankMode::Density;
+				options.targetDensity = juce::jlimit(0.0f, 1.0f, (float)std::atof(v));
+			}
+			else if (auto v = value("--like"))
+			{
+				options.rank = RankMode::Similarity;
+				options.like = v;
+			}
+			else if (auto v = value("--match"))
+				ok = parseTracks(v, options.matchTracks);
+			else if (auto v = value("--sparser"))
+				ok = parseTracks(v, options.sparserTracks);
+			else if (auto v = value("--denser"))
+				ok = parseTracks(v, options.denserTracks);
+			else if (auto v = value("--top"))
+				options.top = juce::jmax(1, std::atoi(v));
+			else
+				ok = false;
+
+			if (!ok)
+			{
+				std::fprintf(stderr, "invalid argument: %s\n", argv[i]);
+				printUsage();
+				return false;
+			}
+		}
+
+		auto& grid = options.grid;
+		grid.numBars = juce::jlimit(1, juce::jmax(1, PatternFeatures::maxSteps / grid.meter.getStepsPerBar()), grid.numBars);
+		for (const auto& name : options.styleNames)
+		{
+			StyleTable::StyleDefinition definition;
+			if (!resolveStyle(options.styleLibrary, name, definition))
+			{
+				std::fprintf(stderr, "unknown style: %s\n", name.c_str());
+				return false;
+			}
+			grid.styles.push_back(definition);
+		}
+		for (int i = 0; i < options.numSeeds; ++i)
+			grid.seeds.push_back(options.firstSeed + (std::uint32_t)i);
+		grid.intensities = options.intensities;
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	ExploreOptions options;
+	if (!parseOptions(argc, argv, options))
+		return 1;
+
+	const auto& grid = options.grid;
+	std::vector<SeedExplorer::Variation> results(SeedExplorer::getNumVariations(grid));
+
+	auto start = Clock::now();
+	SeedExplorer::explore(grid, results.data(), options.numThreads);
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	std::fprintf(stderr, "explored %zu variations in %.3f s (%.0f variations/s)\n",
+		results.size(), seconds, seconds > 0.0 ? (double)results.size() / seconds : 0.0);
+
+	PatternFeatures reference;
+	std::vector<size_t> order;
+	std::vector<float> distances(results.size(), 0.0f);
+	if (options.rank == RankMode::Similarity)
+	{
+		if (!findReference(options, reference))
+		{
+			std::fprintf(stderr, "invalid reference: %s\n", options.like.c_str());
+			return 1;
+		}
+
+		FeatureIndex index;
+		index.reserve(results.size());
+		for (const auto& r : results)
+			index.add(r.features, r.style);
+
+		start = Clock::now();
+		auto matches = index.findNearest(makeQuery(options, reference), options.top);
+		seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		std::fprintf(stderr, "searched %zu candidates in %.3f ms\n", index.size(), seconds * 1000.0);
+
+		for (const auto& match : matches)
+		{
+			order.push_back(match.index);
+			distances[match.index] = match.distance;
+		}
+	}
+	else if (options.rank == RankMode::Density)
+		order = SeedExplorer::rankByDensity(results.data(), results.size(), options.targetDensity);
+	else
+		for (size_t i = 0; i < results.size(); ++i)
+			order.push_back(i);
+
+	size_t count = juce::jmin(order.size(), (size_t)options.top);
+	if (!options.json)
+		std::printf("style,seed,intensity,density,syncopation,mean_velocity,similarity,distance\n");
+	else
+		std::printf("[\n");
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const auto& r = results[order[i]];
+		const char* style = options.styleNames[(size_t)r.style].c_str();
+		float similarity = options.rank == RankMode::Similarity ? PatternFeatures::similarity(r.features, reference) : 0.0f;
+		if (!options.json)
+			std::printf("%s,%u,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f\n", style, r.seed, r.intensity,
+				r.features.density, r.features.syncopation, r.features.meanVelocity, similarity, distances[order[i]]);
+		else
+			std::printf("  {\"style\": \"%s\", \"seed\": %u, \"intensity\": %.2f, \"density\": %.3f, "
+				"\"syncopation\": %.3f, \"mean_velocity\": %.3f, \"similarity\": %.3f, \"distance\": %.3f}%s\n",
+				style, r.seed, r.intensity, r.features.density, r.features.syncopation, r.features.meanVelocity,
+				similarity, distances[order[i]], i + 1 < count ? "," : "");
+	}
+
+	if (options.json)
+		std::printf("]\n");
+	return 0;
+}
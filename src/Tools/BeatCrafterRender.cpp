@@ -0,0 +1,295 @@
+#include "Core/MidiRenderer.h"
+#include "Core/PatternEngine.h"
+#include "Core/StyleLibrary.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace BeatCrafter;
+	using Clock = std::chrono::steady_clock;
+
+	struct SlotStyle
+	{
+		PatternEngine::StyleDefinitionPtr definition;
+		juce::String name;
+	};
+
+	struct RenderOptions
+	{
+		std::string outputPath = "beatcrafter.mid";
+		std::vector<std::string> slotStyleNames;
+		std::vector<SlotStyle> slotStyles;
+		StyleLibrary styleLibrary;
+		std::uint32_t seed = 12345;
+		int batch = 1;
+		int phraseBars = 1;
+		MidiRenderer::Settings settings;
+	};
+
+	constexpr const char* styleNames[] = {
+		"Rock", "Metal", "Jazz", "Funk", "Electronic", "HipHop", "Latin", "Punk"
+	};
+
+	// Built-in names first, then styles from the loaded packs.
+	bool resolveStyle(const StyleLibrary& library, const std::string& name, SlotStyle& style)
+	{
+		for (size_t i = 0; i < std::size(styleNames); ++i)
+		{
+			if (juce::String(name).equalsIgnoreCase(styleNames[i]))
+			{
+				style.definition = std::make_shared<const StyleTable::StyleDefinition>(
+					StyleManager::getStyleDefinition((StyleType)i));
+				style.name = {};
+				return true;
+			}
+		}
+
+		style.definition = library.find(juce::String(name));
+		style.name = juce::String(name);
+		return style.definition != nullptr;
+	}
+
+	std::vector<std::string> splitList(const std::string& text)
+	{
+		std::vector<std::string> items;
+		size_t start = 0;
+		while (start <= text.size())
+		{
+			auto end = text.find(',', start);
+			if (end == std::string::npos)
+				end = text.size();
+			if (end > start)
+				items.push_back(text.substr(start, end - start));
+			start = end + 1;
+		}
+		return items;
+	}
+
+	bool parseSlots(const std::string& text, std::vector<std::string>& names)
+	{
+		names = splitList(text);
+		return !names.empty() && names.size() <= 8;
+	}
+
+	// Either a single value or a list of bar:intensity breakpoints.
+	bool parseIntensityCurve(const std::string& text, std::vector<MidiRenderer::IntensityPoint>& curve)
+	{
+		curve.clear();
+		for (const auto& item : splitList(text))
+		{
+			auto colon = item.find(':');
+			MidiRenderer::IntensityPoint point;
+			if (colon == std::string::npos)
+				point.intensity = (float)std::atof(item.c_str());
+			else
+			{
+				point.bar = std::atof(item.substr(0, colon).c_str());
+				point.intensity = (float)std::atof(item.substr(colon + 1).c_str());
+			}
+			point.intensity = juce::jlimit(0.0f, 1.0f, point.intensity);
+			curve.push_back(point);
+		}
+		return !curve.empty();
+	}
+
+	bool parseSequence(const std::string& text, std::vector<MidiRenderer::SlotCue>& cues)
+	{
+		cues.clear();
+		for (const auto& item : splitList(text))
+		{
+			auto colon = item.find(':');
+			if (colon == std::string::npos)
+				return false;
+
+			MidiRenderer::SlotCue cue;
+			cue.bar = std::atoi(item.substr(0, colon).c_str());
+			cue.slot = std::atoi(item.substr(colon + 1).c_str());
+			if (cue.bar < 0 || cue.slot < 0 || cue.slot >= 8)
+				return false;
+			cues.push_back(cue);
+		}
+		return true;
+	}
+
+	bool parseMeter(const std::string& text, TimeSignature& meter)
+	{
+		auto slash = text.find('/');
+		if (slash == std::string::npos)
+			return false;
+
+		int numerator = std::atoi(text.substr(0, slash).c_str());
+		int denominator = std::atoi(text.substr(slash + 1).c_str());
+		if (numerator < 1 || numerator > 32 || (denominator != 2 && denominator != 4 && denominator != 8 && denominator != 16))
+			return false;
+
+		meter.numerator = numerator;
+		meter.denominator = denominator;
+		return true;
+	}
+
+	// Steps per whole note: 16 for 16ths, 32 for 32nds, 12 or 24 for triplet grids.
+	bool parseResolution(const std::string& text, TimeSignature& meter)
+	{
+		int resolution = std::atoi(text.c_str());
+		if (resolution < 4 || resolution > 64 || resolution % 4 != 0)
+			return false;
+
+		meter.stepsPerQuarter = resolution / 4;
+		return true;
+	}
+
+	juce::File getOutputFile(const RenderOptions& options, int index)
+	{
+		auto file = juce::File::getCurrentWorkingDirectory().getChildFile(options.outputPath);
+		if (options.batch <= 1)
+			return file;
+
+		return file.getSiblingFile(file.getFileNameWithoutExtension()
+			+ "_" + juce::String(index + 1).paddedLeft('0', 4)
+			+ (file.getFileExtension().isEmpty() ? juce::String(".mid") : file.getFileExtension()));
+	}
+
+	void setupSlots(PatternEngine& engine, const RenderOptions& options, std::uint32_t seed)
+	{
+		for (int slot = 0; slot < 8; ++slot)
+		{
+			if (!options.slotStyles.empty())
+			{
+				const auto& style = options.slotStyles[(size_t)slot % options.slotStyles.size()];
+				engine.setSlotStyle(slot, style.definition, style.name);
+			}
+			engine.setSlotSeed(slot, seed + (std::uint32_t)slot);
+			engine.generateNewPatternForSlot(slot, *engine.getSlotStyleDefinition(slot));
+		}
+	}
+
+	void printUsage()
+	{
+		std::fprintf(stderr,
+			"usage: beatcrafter_render [--out=FILE.mid] [--bars=N] [--bpm=X] [--style=NAME | --slots=NAME,NAME,...]\n"
+			"                          [--seed=N] [--intensity=X | --intensity=BAR:X,BAR:X,...]\n"
+			"                          [--sequence=BAR:SLOT,...] [--triplet] [--no-humanize]\n"
+			"                          [--meter=N/D] [--resolution=16|32|12|24] [--phrase=BARS]\n"
+			"                          [--batch=N] [--sample-rate=X] [--block-size=N] [--ppq=N]\n"
+			"                          [--style-pack=FILE ...]\n");
+	}
+
+	bool parseOptions(int argc, char* argv[], RenderOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			auto value = [&](const char* name) -> const char*
+				{
+					auto prefix = std::string(name) + "=";
+					return arg.rfind(prefix, 0) == 0 ? argv[i] + prefix.size() : nullptr;
+				};
+
+			bool ok = true;
+			auto& settings = options.settings;
+			if (arg == "--triplet")
+				settings.tripletMode = true;
+			else if (arg == "--no-humanize")
+				settings.humanize = false;
+			else if (auto v = value("--out"))
+				options.outputPath = v;
+			else if (auto v = value("--bars"))
+				settings.bars = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--bpm"))
+				settings.bpm = juce::jlimit(20.0, 999.0, std::atof(v));
+			else if (auto v = value("--style"))
+				options.slotStyleNames.assign(1, v);
+			else if (auto v = value("--slots"))
+				ok = parseSlots(v, options.slotStyleNames);
+			else if (auto v = value("--style-pack"))
+				ok = options.styleLibrary.addPack(juce::File::getCurrentWorkingDirectory().getChildFile(v));
+			else if (auto v = value("--seed"))
+				options.seed = (std::uint32_t)std::strtoul(v, nullptr, 10);
+			else if (auto v = value("--intensity"))
+				ok = parseIntensityCurve(v, settings.intensityCurve);
+			else if (auto v = value("--sequence"))
+				ok = parseSequence(v, settings.slotCues);
+			else if (auto v = value("--meter"))
+				ok = parseMeter(v, settings.meter);
+			else if (auto v = value("--resolution"))
+				ok = parseResolution(v, settings.meter);
+			else if (auto v = value("--phrase"))
+				options.phraseBars = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--batch"))
+				options.batch = juce::jmax(1, std::atoi(v));
+			else if (auto v = value("--sample-rate"))
+				settings.sampleRate = juce::jmax(8000.0, std::atof(v));
+			else if (auto v = value("--block-size"))
+				settings.blockSize = juce::jlimit(16, 8192, std::atoi(v));
+			else if (auto v = value("--ppq"))
+				settings.ticksPerQuarterNote = juce::jlimit(24, 32767, std::atoi(v));
+			else
+				ok = false;
+
+			if (!ok)
+			{
+				std::fprintf(stderr, "invalid argument: %s\n", argv[i]);
+				printUsage();
+				return false;
+			}
+		}
+
+		for (const auto& name : options.slotStyleNames)
+		{
+			SlotStyle style;
+			if (!resolveStyle(options.styleLibrary, name, style))
+			{
+				std::fprintf(stderr, "unknown style: %s\n", name.c_str());
+				return false;
+			}
+			options.slotStyles.push_back(style);
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	RenderOptions options;
+	if (!parseOptions(argc, argv, options))
+		return 1;
+
+	auto engine = std::make_unique<PatternEngine>();
+	engine->setBackgroundRendering(false);
+	for (int slot = 0; slot < 8; ++slot)
+		engine->setSlotGrid(slot, options.settings.meter, options.phraseBars);
+
+	double renderSeconds = 0.0;
+	for (int i = 0; i < options.batch; ++i)
+	{
+		auto seed = options.seed + (std::uint32_t)i;
+		auto settings = options.settings;
+		settings.playbackSeed = seed;
+		if (!settings.slotCues.empty() && settings.slotCues.front().bar == 0)
+			settings.startSlot = settings.slotCues.front().slot;
+
+		setupSlots(*engine, options, seed);
+
+		auto start = Clock::now();
+		auto sequence = MidiRenderer::render(*engine, settings);
+		renderSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+		auto file = getOutputFile(options, i);
+		if (!MidiRenderer::writeMidiFile(sequence, settings, file))
+		{
+			std::fprintf(stderr, "failed to write %s\n", file.getFullPathName().toRawUTF8());
+			return 1;
+		}
+	}
+
+	double totalBars = (double)options.settings.bars * options.batch;
+	std::fprintf(stderr, "rendered %d file(s), %.0f bars in %.3f s (%.0f bars/s)\n",
+		options.batch, totalBars, renderSeconds, renderSeconds > 0.0 ? totalBars / renderSeconds : 0.0);
+	return 0;
+}
@@ -0,0 +1,142 @@
+#include "Core/StyleDocument.h"
+#include "Core/StyleManager.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace BeatCrafter;
+
+	struct StylePackOptions
+	{
+		std::vector<std::string> sourcePaths;
+		std::string outputPath;
+		std::string builtInsOutputPath;
+		bool checkOnly = false;
+	};
+
+	constexpr const char* builtInStyleNames[] = {
+		"Rock", "Metal", "Jazz", "Funk", "Electronic", "HipHop", "Latin", "Punk"
+	};
+
+	juce::File getFile(const std::string& path)
+	{
+		return juce::File::getCurrentWorkingDirectory().getChildFile(juce::String(path));
+	}
+
+	void printUsage()
+	{
+		std::fprintf(stderr,
+			"usage: beatcrafter_stylepack --out=FILE.bcstyles SOURCE.json ...\n"
+			"       beatcrafter_stylepack --check SOURCE.json ...\n"
+			"       beatcrafter_stylepack --dump-built-ins=FILE.json\n");
+	}
+
+	bool parseOptions(int argc, char* argv[], StylePackOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			auto value = [&](const char* name) -> const char*
+				{
+					auto prefix = std::string(name) + "=";
+					return arg.rfind(prefix, 0) == 0 ? argv[i] + prefix.size() : nullptr;
+				};
+
+			bool ok = true;
+			if (arg == "--check")
+				options.checkOnly = true;
+			else if (auto v = value("--out"))
+				options.outputPath = v;
+			else if (auto v = value("--dump-built-ins"))
+				options.builtInsOutputPath = v;
+			else if (arg.rfind("--", 0) != 0)
+				options.sourcePaths.push_back(arg);
+			else
+				ok = false;
+
+			if (!ok)
+			{
+				std::fprintf(stderr, "invalid argument: %s\n", argv[i]);
+				printUsage();
+				return false;
+			}
+		}
+
+		bool hasSources = !options.sourcePaths.empty();
+		if ((!hasSources && options.builtInsOutputPath.empty())
+			|| (hasSources && !options.checkOnly && options.outputPath.empty()))
+		{
+			printUsage();
+			return false;
+		}
+		return true;
+	}
+
+	// Writes the compiled-in styles as a document to start a pack from.
+	bool dumpBuiltIns(const std::string& path)
+	{
+		std::vector<StylePack::Entry> entries;
+		for (size_t i = 0; i < std::size(builtInStyleNames); ++i)
+			entries.push_back({ builtInStyleNames[i], StyleManager::getStyleDefinition((StyleType)i) });
+
+		return getFile(path).replaceWithText(StyleDocument::toJson(entries));
+	}
+
+	bool compile(const StylePackOptions& options)
+	{
+		std::vector<StylePack::Entry> styles;
+		for (const auto& path : options.sourcePaths)
+		{
+			auto source = getFile(path);
+			if (!source.existsAsFile())
+			{
+				std::fprintf(stderr, "%s: file not found\n", path.c_str());
+				return false;
+			}
+
+			auto result = StyleDocument::parse(source.loadFileAsString(), styles);
+			if (result.failed())
+			{
+				std::fprintf(stderr, "%s: %s\n", path.c_str(), result.getErrorMessage().toRawUTF8());
+				return false;
+			}
+		}
+
+		if (options.checkOnly)
+		{
+			std::fprintf(stderr, "%zu style(s) OK\n", styles.size());
+			return true;
+		}
+
+		auto file = getFile(options.outputPath);
+		file.deleteFile();
+		juce::FileOutputStream stream(file);
+		if (!stream.openedOk() || !StylePack::write(styles, stream))
+		{
+			std::fprintf(stderr, "failed to write %s\n", options.outputPath.c_str());
+			return false;
+		}
+
+		std::fprintf(stderr, "wrote %zu style(s) to %s\n", styles.size(), options.outputPath.c_str());
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	StylePackOptions options;
+	if (!parseOptions(argc, argv, options))
+		return 1;
+
+	if (!options.builtInsOutputPath.empty() && !dumpBuiltIns(options.builtInsOutputPath))
+	{
+		std::fprintf(stderr, "failed to write %s\n", options.builtInsOutputPath.c_str());
+		return 1;
+	}
+
+	if (!options.sourcePaths.empty() && !compile(options))
+		return 1;
+	return 0;
+}